@@ -140,6 +140,8 @@ set(SGAMELIST
     ${GAMELOGIC_DIR}/sgame/sg_spawn_position.cpp
     ${GAMELOGIC_DIR}/sgame/sg_spawn_sensor.cpp
     ${GAMELOGIC_DIR}/sgame/sg_spawn_shared.cpp
+    ${GAMELOGIC_DIR}/sgame/sg_stats.cpp
+    ${GAMELOGIC_DIR}/sgame/sg_stats.h
     ${GAMELOGIC_DIR}/sgame/sg_struct.h
     ${GAMELOGIC_DIR}/sgame/sg_svcmds.cpp
     ${GAMELOGIC_DIR}/sgame/sg_team.cpp
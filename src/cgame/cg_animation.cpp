@@ -23,6 +23,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "cg_local.h"
 
+#include <unordered_map>
+
 /*
 ===============
 CG_RunLerpFrame
@@ -150,15 +152,111 @@ void CG_BlendLerpFrame( lerpFrame_t *lf )
 	}
 }
 
+/*
+===============
+CG_BlendSkeleton
+
+Blends frac of blend into skel, the same as trap_R_BlendSkeleton but without
+the round trip to the engine. The lerp is branchless and written out per
+component so the four rotation lanes can go into one vector operation, the
+square roots of the normalization are batched in a separate pass.
+===============
+*/
+bool CG_BlendSkeleton( refSkeleton_t *skel, const refSkeleton_t *blend, float frac )
+{
+	float invLength[ MAX_BONES ];
+
+	if ( skel->numBones != blend->numBones )
+	{
+		Log::Warn( "CG_BlendSkeleton: different number of bones %d != %d", skel->numBones, blend->numBones );
+		return false;
+	}
+
+	const int   numBones = skel->numBones;
+	const float back = 1.0f - frac;
+
+	for ( int i = 0; i < numBones; i++ )
+	{
+		transform_t       *a = &skel->bones[ i ].t;
+		const transform_t *b = &blend->bones[ i ].t;
+
+		// take the shorter way between the two rotations
+		float dot = a->rot[ 0 ] * b->rot[ 0 ] + a->rot[ 1 ] * b->rot[ 1 ] +
+		            a->rot[ 2 ] * b->rot[ 2 ] + a->rot[ 3 ] * b->rot[ 3 ];
+		float w = copysignf( frac, dot );
+
+		a->rot[ 0 ] = a->rot[ 0 ] * back + b->rot[ 0 ] * w;
+		a->rot[ 1 ] = a->rot[ 1 ] * back + b->rot[ 1 ] * w;
+		a->rot[ 2 ] = a->rot[ 2 ] * back + b->rot[ 2 ] * w;
+		a->rot[ 3 ] = a->rot[ 3 ] * back + b->rot[ 3 ] * w;
+
+		a->trans[ 0 ] = a->trans[ 0 ] * back + b->trans[ 0 ] * frac;
+		a->trans[ 1 ] = a->trans[ 1 ] * back + b->trans[ 1 ] * frac;
+		a->trans[ 2 ] = a->trans[ 2 ] * back + b->trans[ 2 ] * frac;
+		a->scale      = a->scale * back + b->scale * frac;
+
+		invLength[ i ] = a->rot[ 0 ] * a->rot[ 0 ] + a->rot[ 1 ] * a->rot[ 1 ] +
+		                 a->rot[ 2 ] * a->rot[ 2 ] + a->rot[ 3 ] * a->rot[ 3 ];
+	}
+
+	for ( int i = 0; i < numBones; i++ )
+	{
+		invLength[ i ] = 1.0f / sqrtf( std::max( invLength[ i ], 1e-12f ) );
+	}
+
+	for ( int i = 0; i < numBones; i++ )
+	{
+		float *rot = skel->bones[ i ].t.rot;
+
+		rot[ 0 ] *= invLength[ i ];
+		rot[ 1 ] *= invLength[ i ];
+		rot[ 2 ] *= invLength[ i ];
+		rot[ 3 ] *= invLength[ i ];
+	}
+
+	// the blended pose lies within both poses
+	for ( int i = 0; i < 3; i++ )
+	{
+		skel->bounds[ 0 ][ i ] = std::min( skel->bounds[ 0 ][ i ], blend->bounds[ 0 ][ i ] );
+		skel->bounds[ 1 ][ i ] = std::max( skel->bounds[ 1 ][ i ], blend->bounds[ 1 ][ i ] );
+	}
+
+	return true;
+}
+
+/*
+Skeletons built by CG_BuildAnimSkeleton are kept per lerp frame. While the
+lerp state does not change, e.g. for idle buildables, the cached skeleton is
+reused instead of being built by the engine again. Far away entities reuse
+it for up to cg_skeletonLODInterval ms even if it did change.
+
+Lerp frames live in static arrays, so their address is a stable key and the
+cache only ever holds one entry for each lerp frame that is animated.
+*/
+typedef struct
+{
+	const animation_t *animation; // nullptr if nothing was built yet
+	int               oldFrame;
+	int               frame;
+	float             backlerp;
+	bool              blended;    // built while blending, only reused by the LOD
+	int               time;       // cg.time when built
+	refSkeleton_t     skeleton;
+} skeletonCache_t;
+
+static std::unordered_map<const lerpFrame_t *, skeletonCache_t> skeletonCache;
+
 /*
 ===============
 CG_BuildAnimSkeleton
 
 Builds the skeleton for the current animation
 Also blends between the old and new skeletons if necessary
+origin enables the distance based LOD, it may be nullptr
 ===============
 */
-void CG_BuildAnimSkeleton( const lerpFrame_t *lf, refSkeleton_t *newSkeleton, const refSkeleton_t *oldSkeleton )
+void CG_BuildAnimSkeleton( lerpFrame_t *lf, refSkeleton_t *newSkeleton, const refSkeleton_t *oldSkeleton,
+                           const vec3_t origin )
 {
 	if( !lf->animation || !lf->animation->handle )
 	{
@@ -175,21 +273,49 @@ void CG_BuildAnimSkeleton( const lerpFrame_t *lf, refSkeleton_t *newSkeleton, co
 		return;
 	}
 
+	// value initialized on first use, so animation is nullptr
+	skeletonCache_t *cache = &skeletonCache[ lf ];
+	bool            blending = lf->blendlerp > 0.0f;
+
+	if ( cache->animation == lf->animation )
+	{
+		bool unchanged = !blending && !cache->blended && cache->oldFrame == lf->oldFrame &&
+		                 cache->frame == lf->frame && cache->backlerp == lf->backlerp;
+
+		bool far = origin && cg_skeletonLODDistance.value > 0.0f &&
+		           cg.time >= cache->time && cg.time - cache->time < cg_skeletonLODInterval.integer &&
+		           DistanceSquared( origin, cg.refdef.vieworg ) > Square( cg_skeletonLODDistance.value );
+
+		if ( unchanged || far )
+		{
+			*newSkeleton = cache->skeleton;
+			return;
+		}
+	}
+
 	if ( !trap_R_BuildSkeleton( newSkeleton, lf->animation->handle, lf->oldFrame, lf->frame, 1 - lf->backlerp, lf->animation->clearOrigin ) )
 	{
 		Log::Warn( "CG_BuildAnimSkeleton: Can't build skeleton" );
 	}
 
 	// lerp between old and new animation if possible
-	if ( lf->blendlerp >= 0.0f )
+	if ( blending )
 	{
 		if ( newSkeleton->type != refSkeletonType_t::SK_INVALID && oldSkeleton->type != refSkeletonType_t::SK_INVALID && newSkeleton->numBones == oldSkeleton->numBones )
 		{
-			if ( !trap_R_BlendSkeleton( newSkeleton, oldSkeleton, lf->blendlerp ) )
+			if ( !CG_BlendSkeleton( newSkeleton, oldSkeleton, lf->blendlerp ) )
 			{
 				Log::Warn( "CG_BuildAnimSkeleton: Can't blend skeletons" );
 				return;
 			}
 		}
 	}
+
+	cache->animation = lf->animation;
+	cache->oldFrame = lf->oldFrame;
+	cache->frame = lf->frame;
+	cache->backlerp = lf->backlerp;
+	cache->blended = blending;
+	cache->time = cg.time;
+	cache->skeleton = *newSkeleton;
 }
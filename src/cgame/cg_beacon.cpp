@@ -300,12 +300,65 @@ static bool LoadImplicitBeacons()
 	return true;
 }
 
+// beacons sorted by distance in the last frame
+static cbeacon_t *beaconOrder[ MAX_CBEACONS ];
+static int       beaconOrderCount;
+static int       beaconSortCount; // number of SortBeacons calls, stamped into loaded beacons
+
 /**
- * @brief Used by qsort to compare beacons.
+ * @brief Sorts cg.beacons by distance, starting from the order of the last frame.
+ * @note  The order rarely changes between frames, so an insertion sort is close to linear.
  */
-static int CompareBeaconsByDist( const void *a, const void *b )
+static void SortBeacons()
 {
-	return ( *(const cbeacon_t**)a )->dist > ( *(const cbeacon_t**)b )->dist;
+	int count = 0;
+
+	beaconSortCount++;
+
+	for( int beaconNum = 0; beaconNum < cg.beaconCount; beaconNum++ )
+	{
+		cbeacon_t *beacon = cg.beacons[ beaconNum ];
+
+		beacon->loaded = beaconSortCount;
+		beacon->sorted = false;
+		beacon->dist = Distance( cg.predictedPlayerState.origin, beacon->origin );
+	}
+
+	// beacons that are still there keep their place, new ones go at the end
+	for( int beaconNum = 0; beaconNum < beaconOrderCount; beaconNum++ )
+	{
+		cbeacon_t *beacon = beaconOrder[ beaconNum ];
+
+		if( beacon->loaded == beaconSortCount && !beacon->sorted )
+		{
+			beacon->sorted = true;
+			beaconOrder[ count++ ] = beacon;
+		}
+	}
+
+	for( int beaconNum = 0; beaconNum < cg.beaconCount; beaconNum++ )
+	{
+		if( !cg.beacons[ beaconNum ]->sorted )
+		{
+			beaconOrder[ count++ ] = cg.beacons[ beaconNum ];
+		}
+	}
+
+	for( int beaconNum = 0; beaconNum < count; beaconNum++ )
+	{
+		cbeacon_t *beacon = beaconOrder[ beaconNum ];
+		int        j = beaconNum;
+
+		for( ; j > 0 && beaconOrder[ j - 1 ]->dist > beacon->dist; j-- )
+		{
+			beaconOrder[ j ] = beaconOrder[ j - 1 ];
+		}
+
+		beaconOrder[ j ] = beacon;
+	}
+
+	beaconOrderCount = count;
+	memcpy( cg.beacons, beaconOrder, count * sizeof( cbeacon_t* ) );
 }
 
 /**
@@ -358,6 +411,43 @@ static void MarkRelevantBeacons()
 	}
 }
 
+#define BEACON_PROJECT_EPSILON 0.25f // units a beacon or the view may move without projecting it again
+
+static struct
+{
+	vec3_t origin;
+	vec3_t axis[ 3 ];
+	float  fov_x, fov_y;
+	int    width, height;
+	bool   changed; // since the last frame
+} beaconView;
+
+/**
+ * @brief Checks whether beacons have to be projected onto the screen again.
+ */
+static void UpdateBeaconView()
+{
+	const refdef_t *rd = &cg.refdef;
+
+	beaconView.changed =
+		DistanceSquared( rd->vieworg, beaconView.origin ) >= Square( BEACON_PROJECT_EPSILON ) ||
+		!VectorCompare( rd->viewaxis[ 0 ], beaconView.axis[ 0 ] ) ||
+		!VectorCompare( rd->viewaxis[ 1 ], beaconView.axis[ 1 ] ) ||
+		!VectorCompare( rd->viewaxis[ 2 ], beaconView.axis[ 2 ] ) ||
+		rd->fov_x != beaconView.fov_x || rd->fov_y != beaconView.fov_y ||
+		cgs.glconfig.vidWidth != beaconView.width || cgs.glconfig.vidHeight != beaconView.height;
+
+	if( beaconView.changed )
+	{
+		VectorCopy( rd->vieworg, beaconView.origin );
+		AxisCopy( rd->viewaxis, beaconView.axis );
+		beaconView.fov_x = rd->fov_x;
+		beaconView.fov_y = rd->fov_y;
+		beaconView.width = cgs.glconfig.vidWidth;
+		beaconView.height = cgs.glconfig.vidHeight;
+	}
+}
+
 static void SetHighlightedBeacon()
 {
 	for( int beaconNum = 0; beaconNum < cg.beaconCount; beaconNum++ ) {
@@ -367,7 +457,6 @@ static void SetHighlightedBeacon()
 		VectorSubtract( beacon->origin, cg.refdef.vieworg, delta );
 		VectorNormalize( delta );
 		beacon->dot = DotProduct( delta, cg.refdef.viewaxis[ 0 ] );
-		beacon->dist = Distance( cg.predictedPlayerState.origin, beacon->origin );
 
 		// Set highlighted beacon to smallest angle below threshold.
 		if( beacon->dot > cgs.bc.highlightAngle &&
@@ -542,6 +631,17 @@ static void DrawBeacon( cbeacon_t *b )
 		b->size = cgs.bc.hudMinSize;
 	b->size *= b->scale;
 
+	// the last projection is still good if neither the view nor the beacon moved
+	if( b->projected && !beaconView.changed && b->projSize == b->size &&
+	    DistanceSquared( b->origin, b->projOrigin ) < Square( BEACON_PROJECT_EPSILON ) )
+	{
+		return;
+	}
+
+	VectorCopy( b->origin, b->projOrigin );
+	b->projSize = b->size;
+	b->projected = true;
+
 	// project onto screen
 	front = CG_WorldToScreen( b->origin, b->pos, b->pos + 1);
 
@@ -668,8 +768,9 @@ void CG_RunBeacons()
 	LoadExplicitBeacons() && LoadImplicitBeacons();
 
 	// Sort beacons by distance, code below this may assume this.
-	qsort( cg.beacons, cg.beaconCount, sizeof( cbeacon_t* ), CompareBeaconsByDist );
+	SortBeacons();
 
+	UpdateBeaconView();
 	MarkRelevantBeacons();
 	SetHighlightedBeacon();
 
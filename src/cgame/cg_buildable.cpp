@@ -1062,7 +1062,7 @@ static void CG_BuildableAnimation( centity_t *cent, int *old, int *now, float *b
 	{
 		CG_BlendLerpFrame( lf );
 
-		CG_BuildAnimSkeleton( lf, &bSkeleton, &oldbSkeleton );
+		CG_BuildAnimSkeleton( lf, &bSkeleton, &oldbSkeleton, cent->lerpOrigin );
 	}
 }
 
@@ -1618,9 +1618,11 @@ void CG_BuildableStatusParse( const char *filename, buildStat_t *bs )
 	trap_Parse_FreeSource( handle );
 }
 
-#define STATUS_FADE_TIME     200
-#define STATUS_MAX_VIEW_DIST 900.0f
-#define STATUS_PEEK_DIST     20
+#define STATUS_FADE_TIME      200
+#define STATUS_MAX_VIEW_DIST  900.0f
+#define STATUS_PEEK_DIST      20
+#define STATUS_TRACE_BUDGET   12  // buildables whose visibility may be traced per frame
+#define STATUS_TRACE_INTERVAL 100 // ms a visibility trace is trusted for
 
 static Color::Color HealthColorFade( float healthFrac, buildStat_t *bs )
 {
@@ -1680,63 +1682,63 @@ static Color::Color DepletionColorFade( float frac, buildStat_t *bs )
 
 /*
 ==================
-CG_BuildableStatusDisplay
+CG_BuildableStatusStats
 ==================
 */
-static void CG_BuildableStatusDisplay( centity_t *cent )
+static buildStat_t *CG_BuildableStatusStats( centity_t *cent )
 {
-	entityState_t *es = &cent->currentState;
-	vec3_t        origin;
-	float         healthFrac, mineEfficiencyFrac = 0;
-	int           health;
-	float         x, y;
-	bool          powered, marked, showMineEfficiency;
-	trace_t       tr;
-	float         d;
-	buildStat_t   *bs;
-	int           i, j;
-	int           entNum;
-	vec3_t        trOrigin;
-	vec3_t        right;
-	bool          visible = false;
-	vec3_t        mins, maxs;
-	vec3_t        cullMins, cullMaxs;
-	entityState_t *hit;
-	int           anim;
-	const buildableAttributes_t *attr = BG_Buildable( es->modelindex );
-
-	if ( attr->team == TEAM_ALIENS )
+	if ( BG_Buildable( cent->currentState.modelindex )->team == TEAM_ALIENS )
 	{
-		bs = &cgs.alienBuildStat;
+		return &cgs.alienBuildStat;
 	}
 	else
 	{
-		bs = &cgs.humanBuildStat;
+		return &cgs.humanBuildStat;
 	}
+}
 
-	if ( !bs->loaded )
+/*
+==================
+CG_BuildableStatusCandidate
+
+Whether the status of the buildable could be shown at all, checked before
+any tracing is done.
+==================
+*/
+static bool CG_BuildableStatusCandidate( centity_t *cent )
+{
+	vec3_t mins, maxs;
+
+	if ( !CG_BuildableStatusStats( cent )->loaded )
 	{
-		return;
+		return false;
 	}
 
-	d = Distance( cent->lerpOrigin, cg.refdef.vieworg );
-
-	if ( d > STATUS_MAX_VIEW_DIST )
+	if ( DistanceSquared( cent->lerpOrigin, cg.refdef.vieworg ) > Square( STATUS_MAX_VIEW_DIST ) )
 	{
-		return;
+		return false;
 	}
 
-	Color::Color color = bs->foreColor;
+	// cull buildings outside the view frustum
+	BG_BuildableBoundingBox( cent->currentState.modelindex, mins, maxs );
+	VectorAdd( cent->lerpOrigin, mins, mins );
+	VectorAdd( cent->lerpOrigin, maxs, maxs );
 
-	// trace for center point
-	BG_BuildableBoundingBox( es->modelindex, mins, maxs );
+	return !CG_CullBox( mins, maxs );
+}
 
-	// cull buildings outside the view frustum
-	VectorAdd(cent->lerpOrigin, mins, cullMins);
-	VectorAdd(cent->lerpOrigin, maxs, cullMaxs);
+/*
+==================
+CG_BuildableStatusCenter
+==================
+*/
+static void CG_BuildableStatusCenter( centity_t *cent, vec3_t origin )
+{
+	entityState_t *es = &cent->currentState;
+	vec3_t        mins, maxs;
+	int           anim;
 
-	if(CG_CullBox(cullMins, cullMaxs))
-		return;
+	BG_BuildableBoundingBox( es->modelindex, mins, maxs );
 
 	// hack for shrunken barricades
 	anim = es->torsoAnim & ~( ANIM_FORCEBIT | ANIM_TOGGLEBIT );
@@ -1752,11 +1754,32 @@ static void CG_BuildableStatusDisplay( centity_t *cent )
 	// center point
 	origin[ 2 ] += mins[ 2 ];
 	origin[ 2 ] += ( std::abs( mins[ 2 ] ) + std::abs( maxs[ 2 ] ) ) / 2;
+}
+
+/*
+==================
+CG_BuildableStatusTrace
+
+Traces from the view to the center of the buildable, peeking left and right.
+==================
+*/
+static bool CG_BuildableStatusTrace( centity_t *cent )
+{
+	entityState_t *es = &cent->currentState;
+	vec3_t        origin;
+	trace_t       tr;
+	int           i, j;
+	int           entNum;
+	vec3_t        trOrigin;
+	vec3_t        right;
+	entityState_t *hit;
+
+	CG_BuildableStatusCenter( cent, origin );
 
 	entNum = cg.predictedPlayerState.clientNum;
 
 	// if first try fails, step left, step right
-	for ( j = 0; j < 3 && !visible; j++ )
+	for ( j = 0; j < 3; j++ )
 	{
 		VectorCopy( cg.refdef.vieworg, trOrigin );
 
@@ -1785,8 +1808,7 @@ static void CG_BuildableStatusDisplay( centity_t *cent )
 
 			if ( tr.entityNum == cent->currentState.number )
 			{
-				visible = true;
-				break;
+				return true;
 			}
 
 			if ( tr.entityNum == ENTITYNUM_WORLD )
@@ -1810,17 +1832,62 @@ static void CG_BuildableStatusDisplay( centity_t *cent )
 		}
 	}
 
-	// check if visibility state changed
-	if ( !visible && cent->buildableStatus.visible )
+	return false;
+}
+
+/*
+==================
+CG_UpdateBuildableStatusVisibility
+
+Traces are trusted for STATUS_TRACE_INTERVAL and at most STATUS_TRACE_BUDGET
+buildables are traced per frame, the others keep their last result.
+==================
+*/
+static void CG_UpdateBuildableStatusVisibility( centity_t *cent, int *budget )
+{
+	buildableStatus_t *status = &cent->buildableStatus;
+	bool              visible = status->visible;
+
+	if ( cg.time < status->traceTime || cg.time - status->traceTime >= STATUS_TRACE_INTERVAL )
 	{
-		cent->buildableStatus.visible = false;
-		cent->buildableStatus.lastTime = cg.time;
+		if ( *budget > 0 )
+		{
+			( *budget )--;
+			visible = CG_BuildableStatusTrace( cent );
+			status->traceTime = cg.time;
+		}
 	}
-	else if ( visible && !cent->buildableStatus.visible )
+
+	// check if visibility state changed
+	if ( visible != status->visible )
 	{
-		cent->buildableStatus.visible = true;
-		cent->buildableStatus.lastTime = cg.time;
+		status->visible = visible;
+		status->lastTime = cg.time;
 	}
+}
+
+/*
+==================
+CG_BuildableStatusDisplay
+==================
+*/
+static void CG_BuildableStatusDisplay( centity_t *cent )
+{
+	entityState_t *es = &cent->currentState;
+	vec3_t        origin;
+	float         healthFrac, mineEfficiencyFrac = 0;
+	int           health;
+	float         x, y;
+	bool          powered, marked, showMineEfficiency;
+	float         d;
+	buildStat_t   *bs = CG_BuildableStatusStats( cent );
+	const buildableAttributes_t *attr = BG_Buildable( es->modelindex );
+
+	d = Distance( cent->lerpOrigin, cg.refdef.vieworg );
+
+	Color::Color color = bs->foreColor;
+
+	CG_BuildableStatusCenter( cent, origin );
 
 	// Fade up
 	if ( cent->buildableStatus.visible )
@@ -2056,35 +2123,6 @@ static void CG_BuildableStatusDisplay( centity_t *cent )
 	}
 }
 
-/*
-==================
-CG_SortDistance
-==================
-*/
-static int CG_SortDistance( const void *a, const void *b )
-{
-	centity_t *aent, *bent;
-	float     adist, bdist;
-
-	aent = &cg_entities[ * ( int * ) a ];
-	bent = &cg_entities[ * ( int * ) b ];
-	adist = Distance( cg.refdef.vieworg, aent->lerpOrigin );
-	bdist = Distance( cg.refdef.vieworg, bent->lerpOrigin );
-
-	if ( adist > bdist )
-	{
-		return -1;
-	}
-	else if ( adist < bdist )
-	{
-		return 1;
-	}
-	else
-	{
-		return 0;
-	}
-}
-
 /*
 ==================
 CG_PlayerIsBuilder
@@ -2131,20 +2169,30 @@ static bool CG_BuildableRemovalPending( int entityNum )
 	return false;
 }
 
+// entity numbers from far to near, kept from the last frame
+static int      buildableStatusOrder[ MAX_ENTITIES_IN_SNAPSHOT ];
+static unsigned numBuildableStatusOrder;
+
 /*
 ==================
 CG_DrawBuildableStatus
+
+The order of the last frame is kept and repaired with an insertion sort,
+which is linear while the view moves smoothly.
 ==================
 */
 void CG_DrawBuildableStatus()
 {
 	centity_t     *cent;
 	entityState_t *es;
-	int           buildableList[ MAX_ENTITIES_IN_SNAPSHOT ];
-    unsigned      buildables = 0;
+	bool          candidate[ MAX_GENTITIES ] = {};
+	float         dist[ MAX_ENTITIES_IN_SNAPSHOT ];
+	unsigned      buildables = 0;
+	int           budget = STATUS_TRACE_BUDGET;
 
 	if ( !cg_drawBuildableHealth.integer )
 	{
+		numBuildableStatusOrder = 0;
 		return;
 	}
 
@@ -2153,17 +2201,62 @@ void CG_DrawBuildableStatus()
 		cent = &cg_entities[ cg.snap->entities[ i ].number ];
 		es = &cent->currentState;
 
-		if ( es->eType == entityType_t::ET_BUILDABLE && CG_PlayerIsBuilder( (buildable_t) es->modelindex ) )
+		if ( es->eType == entityType_t::ET_BUILDABLE && CG_PlayerIsBuilder( (buildable_t) es->modelindex ) &&
+		     CG_BuildableStatusCandidate( cent ) )
+		{
+			candidate[ es->number ] = true;
+		}
+	}
+
+	// buildables still shown keep their place, new ones go at the end
+	for ( unsigned i = 0; i < numBuildableStatusOrder; i++ )
+	{
+		int entityNum = buildableStatusOrder[ i ];
+
+		if ( candidate[ entityNum ] )
 		{
-			buildableList[ buildables++ ] = cg.snap->entities[ i ].number;
+			candidate[ entityNum ] = false;
+			buildableStatusOrder[ buildables++ ] = entityNum;
 		}
 	}
 
-	qsort( buildableList, buildables, sizeof( int ), CG_SortDistance );
+	for ( unsigned i = 0; i < cg.snap->entities.size(); i++ )
+	{
+		int entityNum = cg.snap->entities[ i ].number;
+
+		if ( candidate[ entityNum ] )
+		{
+			buildableStatusOrder[ buildables++ ] = entityNum;
+		}
+	}
+
+	numBuildableStatusOrder = buildables;
+
+	for ( unsigned i = 0; i < buildables; i++ )
+	{
+		int   entityNum = buildableStatusOrder[ i ];
+		float d = DistanceSquared( cg.refdef.vieworg, cg_entities[ entityNum ].lerpOrigin );
+		int   j = i;
+
+		for ( ; j > 0 && dist[ j - 1 ] < d; j-- )
+		{
+			dist[ j ] = dist[ j - 1 ];
+			buildableStatusOrder[ j ] = buildableStatusOrder[ j - 1 ];
+		}
+
+		dist[ j ] = d;
+		buildableStatusOrder[ j ] = entityNum;
+	}
+
+	// spend the trace budget on the nearest buildables first
+	for ( int i = buildables - 1; i >= 0; i-- )
+	{
+		CG_UpdateBuildableStatusVisibility( &cg_entities[ buildableStatusOrder[ i ] ], &budget );
+	}
 
 	for ( unsigned i = 0; i < buildables; i++ )
 	{
-		CG_BuildableStatusDisplay( &cg_entities[ buildableList[ i ] ] );
+		CG_BuildableStatusDisplay( &cg_entities[ buildableStatusOrder[ i ] ] );
 	}
 
 	if ( cg.predictedPlayerState.stats[ STAT_BUILDABLE ] & SB_BUILDABLE_MASK )
@@ -81,7 +81,7 @@ static void CG_SaveViewpos_f()
 void CG_RequestScores()
 {
 		cg.scoresRequestTime = cg.time;
-		trap_SendClientCommand( "score\n" );
+		trap_SendClientCommand( va( "score %d\n", cg.scoresSeq ) );
 }
 
 void CG_ClientList_f()
@@ -467,6 +467,7 @@ static const struct
 	{ "lcp",              CG_CenterPrint_f,        0                },
 	{ "listmaps",         0,                       0                },
 	{ "listrotation",     0,                       0                },
+	{ "loadTimes",        CG_LoadTimes_f,          0                },
 	{ "luarocket",        Rocket_Lua_f,            0                },
 	{ "m",                0,                       CG_CompleteName  },
 	{ "maplog",           0,                       0                },
@@ -1349,6 +1349,9 @@ void CG_AddPacketEntities()
 		CG_AddCEntity( cent );
 	}
 
+	// the solid entities have their final positions for this frame now
+	CG_InvalidateSolidBroadphase();
+
 	//make an attempt at drawing bounding boxes of selected entity types
 	if ( cg_drawBBOX.integer )
 	{
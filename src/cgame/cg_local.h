@@ -54,7 +54,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define MAX_STEP_CHANGE                32
 
 #define MAX_VERTS_ON_POLY              10
-#define MAX_MARK_POLYS                 256
+#define MAX_MARK_POLYS                 1024 // cg_markLimit caps how many are used
 
 #define STAT_MINUS                     10 // num frame for '-' stats digit
 
@@ -200,9 +200,10 @@ typedef struct attachment_s
 #define MAX_BASEPARTICLE_EJECTORS MAX_BASEPARTICLE_SYSTEMS * MAX_EJECTORS_PER_SYSTEM
 #define MAX_BASEPARTICLES         MAX_BASEPARTICLE_EJECTORS * MAX_PARTICLES_PER_EJECTOR
 
-#define MAX_PARTICLE_SYSTEMS      48
-#define MAX_PARTICLE_EJECTORS     MAX_PARTICLE_SYSTEMS * MAX_EJECTORS_PER_SYSTEM
-#define MAX_PARTICLES             MAX_PARTICLE_EJECTORS * 5
+// storage sizes, cg_particleSystemLimit and cg_particleLimit cap what is used of it
+#define MAX_PARTICLE_SYSTEMS      192
+#define MAX_PARTICLE_EJECTORS     ( MAX_PARTICLE_SYSTEMS * MAX_EJECTORS_PER_SYSTEM )
+#define MAX_PARTICLES             ( MAX_PARTICLE_EJECTORS * 5 )
 
 #define PARTICLES_INFINITE        -1
 #define PARTICLES_SAME_AS_INITIAL -2
@@ -372,6 +373,8 @@ typedef struct particleSystem_s
 	vec3_t   lastNormal;
 
 	int      charge;
+
+	int      numLiveEjectors;
 } particleSystem_t;
 
 typedef struct particleEjector_s
@@ -386,6 +389,8 @@ typedef struct particleEjector_s
 
 	int              nextEjectionTime;
 
+	int              numLiveParticles;
+
 	bool         valid;
 } particleEjector_t;
 
@@ -430,7 +435,15 @@ typedef struct particle_s
 	bool          valid;
 	int               frameWhenInvalidated;
 
-	int               sortKey;
+	int               liveIndex; //position in the live particle list
+	unsigned          sortKey;
+	int               sortGeneration;
+
+	//collision traces may skip frames, the next one sweeps from traceOrigin
+	vec3_t            traceOrigin;
+	int               lastTraceFrame;
+	float             tracePriority;
+	bool              traceThisFrame;
 } particle_t;
 
 //======================================================================
@@ -445,7 +458,8 @@ typedef struct particle_s
 
 #define MAX_TRAIL_SYSTEMS      32
 #define MAX_TRAIL_BEAMS        MAX_TRAIL_SYSTEMS * MAX_BEAMS_PER_SYSTEM
-#define MAX_TRAIL_BEAM_NODES   128
+#define MAX_TRAIL_BEAM_NODES   128 //per beam
+#define MAX_TRAIL_NODES        4096 //shared by all beams
 
 #define MAX_TRAIL_BEAM_JITTERS 4
 
@@ -539,12 +553,12 @@ typedef struct trailBeamNode_s
 	byte                   color[ 3 ];
 
 	vec2_t                 jitters[ MAX_TRAIL_BEAM_JITTERS ];
+	vec2_t                 jitterAmount; // sum of the jitters, up and right
+	vec3_t                 jitterOffset; // jitterAmount projected this frame
 
 	struct trailBeamNode_s *prev;
 
-	struct trailBeamNode_s *next;
-
-	bool               used;
+	struct trailBeamNode_s *next; //next free node while unused
 } trailBeamNode_t;
 
 typedef struct trailBeam_s
@@ -552,14 +566,16 @@ typedef struct trailBeam_s
 	baseTrailBeam_t   *class_;
 	trailSystem_t   *parent;
 
-	trailBeamNode_t nodePool[ MAX_TRAIL_BEAM_NODES ];
 	trailBeamNode_t *nodes;
+	trailBeamNode_t *lastNode;
+	int             numNodes;
 
 	int             lastEvalTime;
 
 	bool        valid;
 
 	int             nextJitterTimes[ MAX_TRAIL_BEAM_JITTERS ];
+	bool            jitterDirty; //jitterAmounts need to be recalculated
 } trailBeam_t;
 
 //======================================================================
@@ -613,6 +629,7 @@ typedef struct buildableStatus_s
 {
 	int      lastTime; // Last time status was visible
 	bool visible; // Status is visible?
+	int      traceTime; // Last time visibility was traced
 } buildableStatus_t;
 
 typedef struct buildableCache_s
@@ -657,6 +674,11 @@ typedef struct
 	// cache
 	float         dot;
 	float         dist;
+	int           loaded; // stamp of the last SortBeacons that saw it
+	bool          sorted;
+	bool          projected; // pos was projected from projOrigin with projSize
+	vec3_t        projOrigin;
+	float         projSize;
 
 	// drawing
 	vec2_t        pos;
@@ -827,9 +849,16 @@ typedef struct markPoly_s
 	struct markPoly_s *prevMark, *nextMark;
 
 	int               time;
+	int               lastVisibleTime;
 	qhandle_t         markShader;
 	bool          alphaFade; // fade alpha instead of rgb
 	float             color[ 4 ];
+
+	// the impact this fragment belongs to
+	vec3_t            origin;
+	vec3_t            normal;
+	float             radius;
+
 	poly_t            poly;
 	polyVert_t        verts[ MAX_VERTS_ON_POLY ];
 } markPoly_t;
@@ -1188,6 +1217,7 @@ typedef struct
 
 	// scoreboard
 	int      scoresRequestTime;
+	int      scoresSeq; // scoreboard sequence number, deltas are sent against it
 	int      numScores;
 	int      selectedScore;
 	int      teamScores[ 2 ];
@@ -1850,6 +1880,7 @@ extern  vmCvar_t            cg_noPlayerAnims;
 extern  vmCvar_t            cg_showmiss;
 extern  vmCvar_t            cg_footsteps;
 extern  vmCvar_t            cg_addMarks;
+extern  vmCvar_t            cg_markLimit;
 extern  vmCvar_t            cg_viewsize;
 extern  vmCvar_t            cg_drawGun;
 extern  vmCvar_t            cg_gun_frame;
@@ -1890,6 +1921,11 @@ extern  vmCvar_t            cg_wwSmoothTime;
 extern  vmCvar_t            cg_disableBlueprintErrors;
 extern  vmCvar_t            cg_depthSortParticles;
 extern  vmCvar_t            cg_bounceParticles;
+extern  vmCvar_t            cg_particleLimit;
+extern  vmCvar_t            cg_particleSystemLimit;
+extern  vmCvar_t            cg_particleTraceBudget;
+extern  vmCvar_t            cg_particleTraceInterval;
+extern  vmCvar_t            cg_particleTraceNearDistance;
 extern  vmCvar_t            cg_consoleLatency;
 extern  vmCvar_t            cg_lightFlare;
 extern  vmCvar_t            cg_debugParticles;
@@ -1950,6 +1986,8 @@ extern vmCvar_t             cg_emoticonsInMessages;
 extern vmCvar_t             cg_chatTeamPrefix;
 
 extern vmCvar_t             cg_animBlend;
+extern vmCvar_t             cg_skeletonLODDistance;
+extern vmCvar_t             cg_skeletonLODInterval;
 
 extern vmCvar_t             cg_highPolyPlayerModels;
 extern vmCvar_t             cg_highPolyBuildableModels;
@@ -1970,6 +2008,7 @@ extern vmCvar_t            rocket_menuFile;
 // cg_main.c
 //
 void       CG_RegisterCvars();
+void       CG_LoadTimes_f();
 const char *CG_ConfigString( int index );
 const char *CG_Argv( int arg );
 const char *CG_Args();
@@ -2104,7 +2143,9 @@ bool CG_GetBuildableRangeMarkerProperties( buildable_t bType, rangeMarker_t *rmT
 void CG_RunLerpFrame( lerpFrame_t *lf, float scale );
 void CG_RunMD5LerpFrame( lerpFrame_t *lf, float scale, bool animChanged );
 void CG_BlendLerpFrame( lerpFrame_t *lf );
-void CG_BuildAnimSkeleton( const lerpFrame_t *lf, refSkeleton_t *newSkeleton, const refSkeleton_t *oldSkeleton );
+bool CG_BlendSkeleton( refSkeleton_t *skel, const refSkeleton_t *blend, float frac );
+void CG_BuildAnimSkeleton( lerpFrame_t *lf, refSkeleton_t *newSkeleton, const refSkeleton_t *oldSkeleton,
+                           const vec3_t origin );
 
 //
 // cg_animmapobj.c
@@ -2117,6 +2158,7 @@ void CG_ModelDoor( centity_t *cent );
 //
 
 void CG_BuildSolidList();
+void CG_InvalidateSolidBroadphase();
 int  CG_PointContents( const vec3_t point, int passEntityNum );
 void CG_Trace( trace_t *result, const vec3_t start, const vec3_t mins, const vec3_t maxs,
                const vec3_t end, int skipNumber, int mask, int skipmask );
@@ -68,6 +68,7 @@ vmCvar_t        cg_noPlayerAnims;
 vmCvar_t        cg_showmiss;
 vmCvar_t        cg_footsteps;
 vmCvar_t        cg_addMarks;
+vmCvar_t        cg_markLimit;
 vmCvar_t        cg_viewsize;
 vmCvar_t        cg_drawGun;
 vmCvar_t        cg_gun_frame;
@@ -112,6 +113,11 @@ vmCvar_t        cg_wwSmoothTime;
 vmCvar_t        cg_disableBlueprintErrors;
 vmCvar_t        cg_depthSortParticles;
 vmCvar_t        cg_bounceParticles;
+vmCvar_t        cg_particleLimit;
+vmCvar_t        cg_particleSystemLimit;
+vmCvar_t        cg_particleTraceBudget;
+vmCvar_t        cg_particleTraceInterval;
+vmCvar_t        cg_particleTraceNearDistance;
 vmCvar_t        cg_consoleLatency;
 vmCvar_t        cg_lightFlare;
 vmCvar_t        cg_debugParticles;
@@ -172,6 +178,8 @@ vmCvar_t        cg_chatTeamPrefix;
 
 vmCvar_t        cg_animSpeed;
 vmCvar_t        cg_animBlend;
+vmCvar_t        cg_skeletonLODDistance;
+vmCvar_t        cg_skeletonLODInterval;
 
 vmCvar_t        cg_highPolyPlayerModels;
 vmCvar_t        cg_highPolyBuildableModels;
@@ -223,6 +231,7 @@ static const cvarTable_t cvarTable[] =
 	{ &cg_crosshairSize,               "cg_crosshairSize",               "1",            0                            },
 	{ &cg_crosshairFile,               "cg_crosshairFile",               "",             0                            },
 	{ &cg_addMarks,                    "cg_marks",                       "1",            0                            },
+	{ &cg_markLimit,                   "cg_markLimit",                   "256",          0                            },
 	{ &cg_lagometer,                   "cg_lagometer",                   "0",            0                            },
 	{ &cg_drawSpeed,                   "cg_drawSpeed",                   "0",            0                            },
 	{ &cg_maxSpeedTimeWindow,          "cg_maxSpeedTimeWindow",          "2000",         0                            },
@@ -275,6 +284,11 @@ static const cvarTable_t cvarTable[] =
 	{ nullptr,                            "cg_flySpeed",                    "800",          CVAR_USERINFO                },
 	{ &cg_depthSortParticles,          "cg_depthSortParticles",          "1",            0                            },
 	{ &cg_bounceParticles,             "cg_bounceParticles",             "0",            0                            },
+	{ &cg_particleLimit,               "cg_particleLimit",               "960",          0                            },
+	{ &cg_particleSystemLimit,         "cg_particleSystemLimit",         "48",           0                            },
+	{ &cg_particleTraceBudget,         "cg_particleTraceBudget",         "256",          0                            },
+	{ &cg_particleTraceInterval,       "cg_particleTraceInterval",       "4",            0                            },
+	{ &cg_particleTraceNearDistance,   "cg_particleTraceNearDistance",   "768",          0                            },
 	{ &cg_consoleLatency,              "cg_consoleLatency",              "3000",         0                            },
 	{ &cg_lightFlare,                  "cg_lightFlare",                  "3",            0                            },
 	{ &cg_debugParticles,              "cg_debugParticles",              "0",            CVAR_CHEAT                   },
@@ -337,6 +351,8 @@ static const cvarTable_t cvarTable[] =
 
 	{ &cg_animSpeed,                   "cg_animspeed",                   "1",            CVAR_CHEAT                   },
 	{ &cg_animBlend,                   "cg_animblend",                   "5.0",          0                            },
+	{ &cg_skeletonLODDistance,         "cg_skeletonLODDistance",         "1536",         0                            },
+	{ &cg_skeletonLODInterval,         "cg_skeletonLODInterval",         "50",           0                            },
 
 	{ &cg_chatTeamPrefix,              "cg_chatTeamPrefix",              "1",            0                            },
 	{ &cg_highPolyPlayerModels,        "cg_highPolyPlayerModels",        "1",            CVAR_LATCH                   },
@@ -360,6 +376,83 @@ static const cvarTable_t cvarTable[] =
 
 static const size_t cvarTableSize = ARRAY_LEN( cvarTable );
 
+static int cvarModificationCounts[ cvarTableSize ];
+
+/*
+ * Side effects of cvar changes, CG_UpdateCvars only runs these for the cvars
+ * that were modified.
+ */
+typedef struct
+{
+	vmCvar_t *vmCvar;
+	void     ( *changed )();
+} cvarHandler_t;
+
+static const cvarHandler_t cvarHandlers[] =
+{
+	{ &cg_rangeMarkerBuildableTypes, CG_UpdateBuildableRangeMarkerMask },
+	{ &cg_rangeMarkerWhenSpectating, CG_UpdateBuildableRangeMarkerMask },
+};
+
+/*
+ * Cvars that are set from the game state every frame. They are only passed on
+ * to the engine when their value actually changes.
+ */
+enum
+{
+	PVAR_TEAMNAME,
+	PVAR_CLASSNAME,
+	PVAR_WEAPONNAME,
+	PVAR_CLASS,
+	PVAR_WEAPON,
+	PVAR_HP,
+	PVAR_MAXHP,
+	PVAR_AMMO,
+	PVAR_CLIPS,
+	PVAR_CREDITS,
+	PVAR_SCORE,
+	PVAR_AVAILABLEBUILDINGS,
+	UIVAR_CARRIAGE,
+
+	NUM_STATE_CVARS
+};
+
+static const char *const stateCvarNames[ NUM_STATE_CVARS ] =
+{
+	"p_teamname",
+	"p_classname",
+	"p_weaponname",
+	"p_class",
+	"p_weapon",
+	"p_hp",
+	"p_maxhp",
+	"p_ammo",
+	"p_clips",
+	"p_credits",
+	"p_score",
+	"p_availableBuildings",
+	"ui_carriage",
+};
+
+static struct
+{
+	char value[ MAX_CVAR_VALUE_STRING ];
+	bool valid;
+} stateCvars[ NUM_STATE_CVARS ];
+
+static void CG_SetStateCvar( int var, const char *value )
+{
+	if ( stateCvars[ var ].valid && !strcmp( stateCvars[ var ].value, value ) )
+	{
+		return;
+	}
+
+	Q_strncpyz( stateCvars[ var ].value, value, sizeof( stateCvars[ var ].value ) );
+	stateCvars[ var ].valid = true;
+
+	trap_Cvar_Set( stateCvarNames[ var ], value );
+}
+
 /*
 =================
 CG_RegisterCvars
@@ -374,6 +467,17 @@ void CG_RegisterCvars()
 	{
 		trap_Cvar_Register( cv->vmCvar, cv->cvarName,
 		                    cv->defaultString, cv->cvarFlags );
+
+		if ( cv->vmCvar )
+		{
+			cvarModificationCounts[ i ] = cv->vmCvar->modificationCount;
+		}
+	}
+
+	// the state cvars may have been changed while we were not running
+	for ( i = 0; i < NUM_STATE_CVARS; i++ )
+	{
+		stateCvars[ i ].valid = false;
 	}
 }
 
@@ -414,7 +518,7 @@ static void CG_SetPVars()
 	        return;
 	}
 
-	trap_Cvar_Set( "p_teamname", BG_TeamName( ps->persistant[ PERS_TEAM ] ) );
+	CG_SetStateCvar( PVAR_TEAMNAME, BG_TeamName( ps->persistant[ PERS_TEAM ] ) );
 
 	switch ( ps->persistant[ PERS_TEAM ] )
 	{
@@ -424,37 +528,37 @@ static void CG_SetPVars()
 
 		default:
 		case TEAM_NONE:
-			trap_Cvar_Set( "p_classname", "Spectator" );
-			trap_Cvar_Set( "p_weaponname", "Nothing" );
+			CG_SetStateCvar( PVAR_CLASSNAME, "Spectator" );
+			CG_SetStateCvar( PVAR_WEAPONNAME, "Nothing" );
 
 			/*
 			 * if we were on a team before we would want these to be reset (or they could mess with bindings)
 			 * the only ones, that actually are helpful to hold on to are p_score and p_credits, since these actually
 			 * might be taken over when joining a team again, or be used to look up old values before leaving the game
 			 */
-			trap_Cvar_Set( "p_class" , "0" );
-			trap_Cvar_Set( "p_weapon", "0" );
-			trap_Cvar_Set( "p_hp", "0" );
-			trap_Cvar_Set( "p_maxhp", "0" );
-			trap_Cvar_Set( "p_ammo", "0" );
-			trap_Cvar_Set( "p_clips", "0" );
+			CG_SetStateCvar( PVAR_CLASS, "0" );
+			CG_SetStateCvar( PVAR_WEAPON, "0" );
+			CG_SetStateCvar( PVAR_HP, "0" );
+			CG_SetStateCvar( PVAR_MAXHP, "0" );
+			CG_SetStateCvar( PVAR_AMMO, "0" );
+			CG_SetStateCvar( PVAR_CLIPS, "0" );
 			return;
 	}
 
-	trap_Cvar_Set( "p_class", va( "%d", ps->stats[ STAT_CLASS ] ) );
+	CG_SetStateCvar( PVAR_CLASS, va( "%d", ps->stats[ STAT_CLASS ] ) );
 
-	trap_Cvar_Set( "p_classname", BG_Class( ps->stats[ STAT_CLASS ] )->name );
+	CG_SetStateCvar( PVAR_CLASSNAME, BG_Class( ps->stats[ STAT_CLASS ] )->name );
 
 
-	trap_Cvar_Set( "p_weapon", va( "%d", ps->stats[ STAT_WEAPON ] ) );
-	trap_Cvar_Set( "p_weaponname", BG_Weapon( ps->stats[ STAT_WEAPON ] )->humanName );
-	trap_Cvar_Set( "p_credits", va( "%d", ps->persistant[ PERS_CREDIT ] ) );
-	trap_Cvar_Set( "p_score", va( "%d", ps->persistant[ PERS_SCORE ] ) );
+	CG_SetStateCvar( PVAR_WEAPON, va( "%d", ps->stats[ STAT_WEAPON ] ) );
+	CG_SetStateCvar( PVAR_WEAPONNAME, BG_Weapon( ps->stats[ STAT_WEAPON ] )->humanName );
+	CG_SetStateCvar( PVAR_CREDITS, va( "%d", ps->persistant[ PERS_CREDIT ] ) );
+	CG_SetStateCvar( PVAR_SCORE, va( "%d", ps->persistant[ PERS_SCORE ] ) );
 
-	trap_Cvar_Set( "p_hp", va( "%d", ps->stats[ STAT_HEALTH ] ) );
-	trap_Cvar_Set( "p_maxhp", va( "%d", ps->stats[ STAT_MAX_HEALTH ] ) );
-	trap_Cvar_Set( "p_ammo", va( "%d", ps->ammo ) );
-	trap_Cvar_Set( "p_clips", va( "%d", ps->clips ) );
+	CG_SetStateCvar( PVAR_HP, va( "%d", ps->stats[ STAT_HEALTH ] ) );
+	CG_SetStateCvar( PVAR_MAXHP, va( "%d", ps->stats[ STAT_MAX_HEALTH ] ) );
+	CG_SetStateCvar( PVAR_AMMO, va( "%d", ps->ammo ) );
+	CG_SetStateCvar( PVAR_CLIPS, va( "%d", ps->clips ) );
 
 	// set p_availableBuildings to a space-separated list of buildings
 	first = true;
@@ -474,7 +578,7 @@ static void CG_SetPVars()
 		}
 	}
 
-	trap_Cvar_Set( "p_availableBuildings", buffer );
+	CG_SetStateCvar( PVAR_AVAILABLEBUILDINGS, buffer );
 }
 
 /*
@@ -492,7 +596,7 @@ static void CG_SetUIVars()
 		return;
 	}
 
-	trap_Cvar_Set( "ui_carriage", va( "%d %d %d", cg.snap->ps.stats[ STAT_WEAPON ],
+	CG_SetStateCvar( UIVAR_CARRIAGE, va( "%d %d %d", cg.snap->ps.stats[ STAT_WEAPON ],
 	               cg.snap->ps.stats[ STAT_ITEMS ], cg.snap->ps.persistant[ PERS_CREDIT ] ) );
 }
 
@@ -503,117 +607,107 @@ CG_UpdateBuildableRangeMarkerMask
 */
 void CG_UpdateBuildableRangeMarkerMask()
 {
-	static int btmc = 0;
-	static int spmc = 0;
+	int         brmMask;
+	char        buffer[ MAX_CVAR_VALUE_STRING ];
+	char        *p, *q;
+	buildable_t buildable;
+
+	brmMask = cg_rangeMarkerWhenSpectating.integer ? ( 1 << BA_NONE ) : 0;
 
-	if ( cg_rangeMarkerBuildableTypes.modificationCount != btmc ||
-	     cg_rangeMarkerWhenSpectating.modificationCount != spmc )
+	if ( !cg_rangeMarkerBuildableTypes.string[ 0 ] )
 	{
-		int         brmMask;
-		char        buffer[ MAX_CVAR_VALUE_STRING ];
-		char        *p, *q;
-		buildable_t buildable;
+		goto empty;
+	}
+
+	Q_strncpyz( buffer, cg_rangeMarkerBuildableTypes.string, sizeof( buffer ) );
+	p = &buffer[ 0 ];
 
-		brmMask = cg_rangeMarkerWhenSpectating.integer ? ( 1 << BA_NONE ) : 0;
+	for ( ;; )
+	{
+		q = strchr( p, ',' );
 
-		if ( !cg_rangeMarkerBuildableTypes.string[ 0 ] )
+		if ( q )
 		{
-			goto empty;
+			*q = '\0';
 		}
 
-		Q_strncpyz( buffer, cg_rangeMarkerBuildableTypes.string, sizeof( buffer ) );
-		p = &buffer[ 0 ];
-
-		for ( ;; )
+		while ( *p == ' ' )
 		{
-			q = strchr( p, ',' );
+			++p;
+		}
 
-			if ( q )
-			{
-				*q = '\0';
-			}
+		buildable = BG_BuildableByName( p )->number;
 
-			while ( *p == ' ' )
+		if ( buildable != BA_NONE )
+		{
+			brmMask |= 1 << buildable;
+		}
+		else if ( !Q_stricmp( p, "all" ) )
+		{
+			brmMask |= ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) | ( 1 << BA_A_ACIDTUBE ) |
+			           ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) | ( 1 << BA_A_LEECH ) |
+			           ( 1 << BA_A_BOOSTER ) | ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) |
+			           ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) | ( 1 << BA_H_DRILL );
+		}
+		else if ( !Q_stricmp( p, "none" ) )
+		{
+			brmMask = 0;
+		}
+		else
+		{
+			char *pp;
+			int  only;
+
+			if ( !Q_strnicmp( p, "alien", 5 ) )
 			{
-				++p;
+				pp = p + 5;
+				only = ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) |
+				       ( 1 << BA_A_ACIDTUBE ) | ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) | ( 1 << BA_A_LEECH ) | ( 1 << BA_A_BOOSTER );
 			}
-
-			buildable = BG_BuildableByName( p )->number;
-
-			if ( buildable != BA_NONE )
+			else if ( !Q_strnicmp( p, "human", 5 ) )
 			{
-				brmMask |= 1 << buildable;
+				pp = p + 5;
+				only = ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) |
+				       ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) | ( 1 << BA_H_DRILL );
 			}
-			else if ( !Q_stricmp( p, "all" ) )
+			else
 			{
-				brmMask |= ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) | ( 1 << BA_A_ACIDTUBE ) |
-				           ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) | ( 1 << BA_A_LEECH ) |
-				           ( 1 << BA_A_BOOSTER ) | ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) |
-				           ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) | ( 1 << BA_H_DRILL );
+				pp = p;
+				only = ~0;
 			}
-			else if ( !Q_stricmp( p, "none" ) )
+
+			if ( pp != p && !*pp )
 			{
-				brmMask = 0;
+				brmMask |= only;
 			}
-			else
+			else if ( !Q_stricmp( pp, "support" ) )
 			{
-				char *pp;
-				int  only;
-
-				if ( !Q_strnicmp( p, "alien", 5 ) )
-				{
-					pp = p + 5;
-					only = ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) |
-					       ( 1 << BA_A_ACIDTUBE ) | ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) | ( 1 << BA_A_LEECH ) | ( 1 << BA_A_BOOSTER );
-				}
-				else if ( !Q_strnicmp( p, "human", 5 ) )
-				{
-					pp = p + 5;
-					only = ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) |
-					       ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) | ( 1 << BA_H_DRILL );
-				}
-				else
-				{
-					pp = p;
-					only = ~0;
-				}
-
-				if ( pp != p && !*pp )
-				{
-					brmMask |= only;
-				}
-				else if ( !Q_stricmp( pp, "support" ) )
-				{
-					brmMask |= only & ( ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) | ( 1 << BA_A_LEECH ) | ( 1 << BA_A_BOOSTER ) |
-					                    ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) | ( 1 << BA_H_DRILL ) );
-				}
-				else if ( !Q_stricmp( pp, "offensive" ) )
-				{
-					brmMask |= only & ( ( 1 << BA_A_ACIDTUBE ) | ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) |
-					                    ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) );
-				}
-				else
-				{
-					Log::Warn( "unknown buildable or group: %s", p );
-				}
+				brmMask |= only & ( ( 1 << BA_A_OVERMIND ) | ( 1 << BA_A_SPAWN ) | ( 1 << BA_A_LEECH ) | ( 1 << BA_A_BOOSTER ) |
+				                    ( 1 << BA_H_REACTOR ) | ( 1 << BA_H_REPEATER ) | ( 1 << BA_H_DRILL ) );
 			}
-
-			if ( q )
+			else if ( !Q_stricmp( pp, "offensive" ) )
 			{
-				p = q + 1;
+				brmMask |= only & ( ( 1 << BA_A_ACIDTUBE ) | ( 1 << BA_A_TRAPPER ) | ( 1 << BA_A_HIVE ) |
+				                    ( 1 << BA_H_MGTURRET ) | ( 1 << BA_H_ROCKETPOD ) );
 			}
 			else
 			{
-				break;
+				Log::Warn( "unknown buildable or group: %s", p );
 			}
 		}
 
-empty:
-		trap_Cvar_Set( "cg_buildableRangeMarkerMask", va( "%i", brmMask ) );
-
-		btmc = cg_rangeMarkerBuildableTypes.modificationCount;
-		spmc = cg_rangeMarkerWhenSpectating.modificationCount;
+		if ( q )
+		{
+			p = q + 1;
+		}
+		else
+		{
+			break;
+		}
 	}
+
+empty:
+	trap_Cvar_Set( "cg_buildableRangeMarkerMask", va( "%i", brmMask ) );
 }
 
 void CG_NotifyHooks()
@@ -656,18 +750,51 @@ void CG_UpdateCvars()
 	size_t i;
 	const cvarTable_t *cv;
 
+	void     ( *pending[ ARRAY_LEN( cvarHandlers ) ] )();
+	int      numPending = 0;
+
 	for ( i = 0, cv = cvarTable; i < cvarTableSize; i++, cv++ )
 	{
-		if ( cv->vmCvar )
+		if ( !cv->vmCvar )
+		{
+			continue;
+		}
+
+		trap_Cvar_Update( cv->vmCvar );
+
+		if ( cvarModificationCounts[ i ] == cv->vmCvar->modificationCount )
 		{
-			trap_Cvar_Update( cv->vmCvar );
+			continue;
+		}
+
+		cvarModificationCounts[ i ] = cv->vmCvar->modificationCount;
+
+		// several cvars may share a handler, run it once
+		for ( const cvarHandler_t &handler : cvarHandlers )
+		{
+			int j;
+
+			if ( handler.vmCvar != cv->vmCvar )
+			{
+				continue;
+			}
+
+			for ( j = 0; j < numPending && pending[ j ] != handler.changed; j++ );
+
+			if ( j == numPending )
+			{
+				pending[ numPending++ ] = handler.changed;
+			}
 		}
 	}
 
-	// check for modifications here
+	for ( int j = 0; j < numPending; j++ )
+	{
+		pending[ j ]();
+	}
+
 	CG_SetPVars();
 	CG_SetUIVars();
-	CG_UpdateBuildableRangeMarkerMask();
 }
 
 int CG_CrosshairPlayer()
@@ -892,29 +1019,73 @@ enum {
 	LOAD_DONE
 } typedef cgLoadingStep_t;
 
+static const char *const loadingStepNames[] =
+{
+	"",
+	"start",
+	"trails",
+	"particles",
+	"sounds",
+	"geometry",
+	"assets",
+	"configs",
+	"weapons",
+	"upgrades",
+	"classes",
+	"buildings",
+	"remaining",
+	"done"
+};
+
+// milliseconds spent in each step of the last load, for CG_LoadTimes_f
+static int loadingStepTimes[ LOAD_DONE + 1 ];
+
+static int CG_LoadingTime()
+{
+	int total = 0;
+
+	for ( int step = LOAD_START; step < LOAD_DONE; step++ )
+	{
+		total += loadingStepTimes[ step ];
+	}
+
+	return total;
+}
+
+/*
+=================
+CG_LoadTimes_f
+
+Prints where the time of the last load went.
+=================
+*/
+void CG_LoadTimes_f()
+{
+	for ( int step = LOAD_START; step < LOAD_DONE; step++ )
+	{
+		Log::Notice( "%-10s %6ims", loadingStepNames[ step ], loadingStepTimes[ step ] );
+	}
+
+	Log::Notice( "%-10s %6ims%s", "total", CG_LoadingTime(), cg.loading ? " (still loading)" : "" );
+}
+
 static void CG_UpdateLoadingStep( cgLoadingStep_t step )
 {
-#if 0
-	static int startTime = 0;
+	static cgLoadingStep_t lastStep;
 	static int lastStepTime = 0;
 	const int thisStepTime = trap_Milliseconds();
 
-	switch (step) {
-		case LOAD_START:
-			startTime = thisStepTime;
-			Log::Notice("^4%%^5 Start loading.");
-			break;
-		case LOAD_DONE:
-			Log::Notice("^4%%^5 Done loading everything after %is (%ims).",
-					(thisStepTime - startTime)/1000, (thisStepTime - startTime));
-			break;
-		default:
-			Log::Notice("^4%%^5 Done with Step %i after %is (%ims)… Starting Step %i",
-					step - 1, (thisStepTime - lastStepTime)/1000, (thisStepTime - lastStepTime), step );
-			break;
+	if ( step == LOAD_START )
+	{
+		memset( loadingStepTimes, 0, sizeof( loadingStepTimes ) );
 	}
+	else
+	{
+		loadingStepTimes[ lastStep ] += thisStepTime - lastStepTime;
+	}
+
+	lastStep = step;
 	lastStepTime = thisStepTime;
-#endif
 
 	switch (step) {
 		case LOAD_START:
@@ -957,6 +1128,8 @@ static void CG_UpdateLoadingStep( cgLoadingStep_t step )
 			Q_strncpyz(cg.currentLoadingLabel, "Done!", sizeof( cg.currentLoadingLabel ) );
 			trap_UpdateScreen();
 			cg.loading = false;
+
+			Log::Debug( "Loading took %ims, see loadTimes for details", CG_LoadingTime() );
 			break;
 
 		default:
@@ -1650,6 +1823,9 @@ void CG_Init( int serverMessageNum, int clientNum, glconfig_t gl, GameStateCSs g
 	CG_UpdateLoadingStep( LOAD_CONFIGS );
 	BG_InitAllConfigs();
 
+	// needs the buildable names, so it can't be done when registering the cvars
+	CG_UpdateBuildableRangeMarkerMask();
+
 	// load weapons upgrades and buildings after configs
 	CG_UpdateLoadingStep( LOAD_WEAPONS );
 	CG_InitWeapons();
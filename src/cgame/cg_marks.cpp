@@ -36,7 +36,12 @@ MARK POLYS
 markPoly_t cg_activeMarkPolys; // double linked list
 markPoly_t *cg_freeMarkPolys; // single linked list
 markPoly_t cg_markPolys[ MAX_MARK_POLYS ];
-static int markTotal;
+static int markTotal; // active marks
+static int lastMarkFrameTime; // cg.time of the last CG_AddMarks
+
+#define MARK_EVICT_SCAN     32    // how many of the oldest marks are checked for an invisible one
+#define MARK_MERGE_SCAN     16    // how many of the newest marks an impact may merge into
+#define MARK_MERGE_FRACTION 0.25f // of the radius
 
 /*
 ===================
@@ -59,6 +64,8 @@ void CG_InitMarkPolys()
 	{
 		cg_markPolys[ i ].nextMark = &cg_markPolys[ i + 1 ];
 	}
+
+	markTotal = 0;
 }
 
 /*
@@ -79,7 +86,70 @@ void CG_FreeMarkPoly( markPoly_t *le )
 
 	// the free list is only singly linked
 	le->nextMark = cg_freeMarkPolys;
+	le->prevMark = nullptr;
 	cg_freeMarkPolys = le;
+
+	markTotal--;
+}
+
+/*
+==================
+CG_SameImpact
+
+Whether two marks are fragments of the same impact, those are always
+adjacent in the active list
+==================
+*/
+static bool CG_SameImpact( const markPoly_t *a, const markPoly_t *b )
+{
+	return a->time == b->time && VectorCompare( a->origin, b->origin );
+}
+
+/*
+==================
+CG_FreeImpactMarks
+
+Free a mark together with the other fragments of its impact
+==================
+*/
+static void CG_FreeImpactMarks( markPoly_t *mp )
+{
+	while ( mp->nextMark != &cg_activeMarkPolys && CG_SameImpact( mp->nextMark, mp ) )
+	{
+		CG_FreeMarkPoly( mp->nextMark );
+	}
+
+	while ( mp->prevMark != &cg_activeMarkPolys && CG_SameImpact( mp->prevMark, mp ) )
+	{
+		CG_FreeMarkPoly( mp->prevMark );
+	}
+
+	CG_FreeMarkPoly( mp );
+}
+
+/*
+==================
+CG_FreeLeastVisibleMark
+
+Free the oldest impact that wasn't drawn last frame, looking only at the
+oldest few, or the oldest one if they were all visible
+==================
+*/
+static void CG_FreeLeastVisibleMark()
+{
+	markPoly_t *mp = cg_activeMarkPolys.prevMark;
+	int        i;
+
+	for ( i = 0; i < MARK_EVICT_SCAN && mp != &cg_activeMarkPolys; i++, mp = mp->prevMark )
+	{
+		if ( mp->lastVisibleTime != lastMarkFrameTime )
+		{
+			CG_FreeImpactMarks( mp );
+			return;
+		}
+	}
+
+	CG_FreeImpactMarks( cg_activeMarkPolys.prevMark );
 }
 
 /*
@@ -92,18 +162,11 @@ Will always succeed, even if it requires freeing an old active mark
 markPoly_t *CG_AllocMark()
 {
 	markPoly_t *le;
-	int        time;
+	int        limit = Math::Clamp( cg_markLimit.integer, 1, MAX_MARK_POLYS );
 
-	if ( !cg_freeMarkPolys )
+	while ( markTotal && ( !cg_freeMarkPolys || markTotal >= limit ) )
 	{
-		// no free entities, so free the one at the end of the chain
-		// remove the oldest active entity
-		time = cg_activeMarkPolys.prevMark->time;
-
-		while ( cg_activeMarkPolys.prevMark && time == cg_activeMarkPolys.prevMark->time )
-		{
-			CG_FreeMarkPoly( cg_activeMarkPolys.prevMark );
-		}
+		CG_FreeLeastVisibleMark();
 	}
 
 	le = cg_freeMarkPolys;
@@ -116,9 +179,91 @@ markPoly_t *CG_AllocMark()
 	le->prevMark = &cg_activeMarkPolys;
 	cg_activeMarkPolys.nextMark->prevMark = le;
 	cg_activeMarkPolys.nextMark = le;
+
+	markTotal++;
 	return le;
 }
 
+/*
+===================
+CG_MergeImpactMark
+
+Rapid fire puts many marks on nearly the same spot. If a recent impact mark
+matches this one, move it to the front of the list as if it were new instead
+of projecting another one.
+===================
+*/
+static bool CG_MergeImpactMark( qhandle_t markShader, const vec3_t origin, const vec3_t normal,
+                                const float *color, bool alphaFade, float radius )
+{
+	markPoly_t *mp, *first, *last, *next;
+	int        i, j;
+
+	for ( i = 0, mp = cg_activeMarkPolys.nextMark; i < MARK_MERGE_SCAN && mp != &cg_activeMarkPolys;
+	      i++, mp = mp->nextMark )
+	{
+		if ( mp->markShader == markShader && mp->alphaFade == alphaFade &&
+		     fabsf( mp->radius - radius ) <= radius * 0.1f &&
+		     DotProduct( mp->normal, normal ) > 0.99f &&
+		     DistanceSquared( mp->origin, origin ) < Square( radius * MARK_MERGE_FRACTION ) &&
+		     VectorCompare( mp->color, color ) && mp->color[ 3 ] == color[ 3 ] )
+		{
+			break;
+		}
+	}
+
+	if ( i == MARK_MERGE_SCAN || mp == &cg_activeMarkPolys )
+	{
+		return false;
+	}
+
+	// find all fragments of that impact
+	for ( first = mp; first->prevMark != &cg_activeMarkPolys && CG_SameImpact( first->prevMark, mp ); )
+	{
+		first = first->prevMark;
+	}
+
+	for ( last = mp; last->nextMark != &cg_activeMarkPolys && CG_SameImpact( last->nextMark, mp ); )
+	{
+		last = last->nextMark;
+	}
+
+	// undo any fading
+	for ( mp = first; ; mp = mp->nextMark )
+	{
+		mp->time = cg.time;
+
+		for ( j = 0; j < mp->poly.numVerts; j++ )
+		{
+			mp->verts[ j ].modulate[ 0 ] = mp->color[ 0 ] * 255;
+			mp->verts[ j ].modulate[ 1 ] = mp->color[ 1 ] * 255;
+			mp->verts[ j ].modulate[ 2 ] = mp->color[ 2 ] * 255;
+			mp->verts[ j ].modulate[ 3 ] = mp->color[ 3 ] * 255;
+		}
+
+		if ( mp == last )
+		{
+			break;
+		}
+	}
+
+	// move the run to the front so eviction still sees the oldest marks last
+	if ( first != cg_activeMarkPolys.nextMark )
+	{
+		next = last->nextMark;
+
+		first->prevMark->nextMark = next;
+		next->prevMark = first->prevMark;
+
+		first->prevMark = &cg_activeMarkPolys;
+		last->nextMark = cg_activeMarkPolys.nextMark;
+		cg_activeMarkPolys.nextMark->prevMark = last;
+		cg_activeMarkPolys.nextMark = first;
+	}
+
+	return true;
+}
+
 /*
 =================
 CG_ImpactMark
@@ -165,12 +310,19 @@ void CG_ImpactMark( qhandle_t markShader, const vec3_t origin, const vec3_t dir,
 		Com_Error(errorParm_t::ERR_DROP,  "CG_ImpactMark called with <= 0 radius" );
 	}
 
-	//if ( markTotal >= MAX_MARK_POLYS ) {
-	//  return;
-	//}
-
 	// create the texture axis
 	VectorNormalize2( dir, axis[ 0 ] );
+
+	if ( !temporary )
+	{
+		const float color[ 4 ] = { red, green, blue, alpha };
+
+		if ( CG_MergeImpactMark( markShader, origin, axis[ 0 ], color, alphaFade, radius ) )
+		{
+			return;
+		}
+	}
+
 	PerpendicularVector( axis[ 1 ], axis[ 0 ] );
 	RotatePointAroundVector( axis[ 2 ], axis[ 0 ], axis[ 1 ], orientation );
 	CrossProduct( axis[ 0 ], axis[ 2 ], axis[ 1 ] );
@@ -239,11 +391,35 @@ void CG_ImpactMark( qhandle_t markShader, const vec3_t origin, const vec3_t dir,
 		mark->color[ 1 ] = green;
 		mark->color[ 2 ] = blue;
 		mark->color[ 3 ] = alpha;
+		VectorCopy( origin, mark->origin );
+		VectorCopy( axis[ 0 ], mark->normal );
+		mark->radius = radius;
 		memcpy( mark->verts, verts, mf->numPoints * sizeof( verts[ 0 ] ) );
-		markTotal++;
 	}
 }
 
+/*
+===============
+CG_CullMark
+
+Frustum and PVS test for the whole impact a mark belongs to
+===============
+*/
+static bool CG_CullMark( const markPoly_t *mp )
+{
+	vec3_t point;
+
+	if ( CG_CullPointAndRadius( mp->origin, M_SQRT2 * mp->radius ) )
+	{
+		return true;
+	}
+
+	// the origin may be right on the surface, test just in front of it
+	VectorMA( mp->origin, 1.0f, mp->normal, point );
+
+	return !trap_R_inPVS( cg.refdef.vieworg, point );
+}
+
 /*
 ===============
 CG_AddMarks
@@ -258,12 +434,20 @@ void CG_AddMarks()
 	markPoly_t *mp, *next;
 	int        t;
 	int        fade;
+	bool       haveImpact = false;
+	int        impactTime = 0;
+	vec3_t     impactOrigin;
+	bool       impactCulled = false;
 
 	if ( !cg_addMarks.integer )
 	{
 		return;
 	}
 
+	lastMarkFrameTime = cg.time;
+
+	VectorClear( impactOrigin );
+
 	mp = cg_activeMarkPolys.nextMark;
 
 	for ( ; mp != &cg_activeMarkPolys; mp = next )
@@ -279,6 +463,20 @@ void CG_AddMarks()
 			continue;
 		}
 
+		// the fragments of an impact are adjacent and share the test
+		if ( !haveImpact || mp->time != impactTime || !VectorCompare( mp->origin, impactOrigin ) )
+		{
+			haveImpact = true;
+			impactTime = mp->time;
+			VectorCopy( mp->origin, impactOrigin );
+			impactCulled = CG_CullMark( mp );
+		}
+
+		if ( impactCulled )
+		{
+			continue;
+		}
+
 		// fade all marks out with time
 		t = mp->time + MARK_TOTAL_TIME - cg.time;
 
@@ -303,6 +501,8 @@ void CG_AddMarks()
 				}
 			}
 		}
+
+		mp->lastVisibleTime = cg.time;
 		trap_R_AddPolyToScene( mp->markShader, mp->poly.numVerts, mp->verts );
 	}
 }
@@ -37,6 +37,334 @@ static particle_t            particles[ MAX_PARTICLES ];
 static particle_t            *sortedParticles[ MAX_PARTICLES ];
 static particle_t            *radixBuffer[ MAX_PARTICLES ];
 
+//systems and ejectors take the lowest free slot, so scans over them can stop
+//after the highest slot in use
+static int                   numParticleSystemSlots = 0;
+static int                   numParticleEjectorSlots = 0;
+
+//the depth sort is only redone from scratch when the view moved or turned more than this
+#define PARTICLE_SORT_MAX_MOVE   16.0f
+#define PARTICLE_SORT_MIN_DOT    0.995f
+#define PARTICLE_SORT_MAX_FRAMES 8 //particles move too
+
+static struct
+{
+	int    generation;
+	int    numSorted;
+	int    frame;
+	vec3_t origin;
+	vec3_t forward;
+} particleSort;
+
+/*
+particles[] only provides storage, attachments, child systems and trails keep
+pointers to individual particles so they never move. Free slots are kept on a
+stack and the slot of a destroyed particle only goes back onto it once the
+grace period other systems rely on has passed (see CG_DestroyParticle).
+
+Live particles are listed densely and the values that are interpolated over
+their lifetime are kept next to that list as structure of arrays, in the same
+order, so per frame work only touches live particles and the interpolation is
+a straight loop.
+*/
+enum particleChannel_t
+{
+	PCH_TIME,
+	PCH_RADIUS,
+	PCH_ALPHA,
+	PCH_ROTATION,
+	PCH_COLOR,
+	PCH_DLIGHT_RADIUS,
+
+	PCH_NUM_CHANNELS
+};
+
+typedef struct
+{
+	int   start[ MAX_PARTICLES ];
+	float invDuration[ MAX_PARTICLES ];
+	float initial[ MAX_PARTICLES ];
+	float range[ MAX_PARTICLES ];
+	float value[ MAX_PARTICLES ]; //result for cg.time
+} particleChannelData_t;
+
+static struct
+{
+	particle_t            *live[ MAX_PARTICLES ];
+	int                   numLive;
+
+	particleChannelData_t channels[ PCH_NUM_CHANNELS ];
+
+	int                   free[ MAX_PARTICLES ];
+	int                   numFree;
+
+	//destroyed particles waiting for their slot to be reused, oldest first
+	int                   released[ MAX_PARTICLES ];
+	int                   releasedHead;
+	int                   numReleased;
+} particleStore;
+
+/*
+Collision work is bounded per frame. Particles closer to the view than
+cg_particleTraceNearDistance are traced every frame, the others at most every
+cg_particleTraceInterval frames and only while cg_particleTraceBudget lasts,
+the closest and longest waiting first. A skipped particle keeps moving and its
+next trace sweeps the whole path since the last one, so it can't tunnel
+through walls, it just reacts late.
+
+Point contents checks go through a cache of world cells known to hold no solid
+or nodrop brushes, the world doesn't change during a map.
+*/
+#define PARTICLE_CELL_SIZE  64
+#define PARTICLE_CELL_CACHE 4096 //must be a power of two
+
+enum particleCellState_t
+{
+	PCELL_UNKNOWN,
+	PCELL_EMPTY,
+	PCELL_OCCUPIED
+};
+
+typedef struct
+{
+	int                 x, y, z;
+	particleCellState_t state;
+} particleCell_t;
+
+static particleCell_t particleCells[ PARTICLE_CELL_CACHE ];
+
+static struct
+{
+	int traces;        //collision traces done
+	int deferred;      //collision traces put off to a later frame
+	int contents;      //point contents queries that went to the engine
+	int cellHits;      //point contents answered from the cell cache
+	int cellTests;     //cells classified
+} particleTraceCounts;
+
+/*
+===============
+CG_ResetParticleStorage
+
+Clear all run time particle state
+===============
+*/
+static void CG_ResetParticleStorage()
+{
+	int i;
+
+	memset( particleSystems, 0, sizeof( particleSystems ) );
+	memset( particleEjectors, 0, sizeof( particleEjectors ) );
+	memset( particles, 0, sizeof( particles ) );
+
+	numParticleSystemSlots = 0;
+	numParticleEjectorSlots = 0;
+
+	particleStore.numLive = 0;
+	particleStore.releasedHead = 0;
+	particleStore.numReleased = 0;
+
+	//hand out the low slots first
+	for ( i = 0; i < MAX_PARTICLES; i++ )
+	{
+		particleStore.free[ i ] = MAX_PARTICLES - 1 - i;
+	}
+
+	particleStore.numFree = MAX_PARTICLES;
+
+	//new map, new world
+	memset( particleCells, 0, sizeof( particleCells ) );
+}
+
+/*
+===============
+CG_AllocParticle
+
+Take a free particle slot, or return nullptr if cg_particleLimit is reached
+===============
+*/
+static particle_t *CG_AllocParticle()
+{
+	particle_t *p;
+
+	if ( particleStore.numLive >= Math::Clamp( cg_particleLimit.integer, 1, MAX_PARTICLES ) ||
+	     !particleStore.numFree )
+	{
+		return nullptr;
+	}
+
+	p = &particles[ particleStore.free[ --particleStore.numFree ] ];
+	memset( p, 0, sizeof( particle_t ) );
+	p->liveIndex = -1;
+
+	return p;
+}
+
+/*
+===============
+CG_FreeParticle
+
+Return a slot that never became live
+===============
+*/
+static void CG_FreeParticle( particle_t *p )
+{
+	particleStore.free[ particleStore.numFree++ ] = p - particles;
+}
+
+/*
+===============
+CG_ReclaimParticles
+
+Make the slots of particles destroyed long enough ago available again
+===============
+*/
+static void CG_ReclaimParticles()
+{
+	while ( particleStore.numReleased )
+	{
+		int index = particleStore.released[ particleStore.releasedHead ];
+
+		//FIXME: the + 1 may be unnecessary
+		if ( cg.clientFrame <= particles[ index ].frameWhenInvalidated + 1 )
+		{
+			break;
+		}
+
+		particleStore.free[ particleStore.numFree++ ] = index;
+		particleStore.releasedHead = ( particleStore.releasedHead + 1 ) % MAX_PARTICLES;
+		particleStore.numReleased--;
+	}
+}
+
+/*
+===============
+CG_SetParticleChannel
+
+Set up the interpolation of a value over the life of a live particle
+===============
+*/
+static void CG_SetParticleChannel( int channel, const particle_t *p, int delay, float initial, float final )
+{
+	particleChannelData_t *c = &particleStore.channels[ channel ];
+	int                   k = p->liveIndex;
+	int                   duration = p->lifeTime - delay;
+
+	c->start[ k ] = p->birthTime + delay;
+	//a value delayed beyond the end of the particle's life never changes
+	c->invDuration[ k ] = duration > 0 ? 1.0f / ( float ) duration : 0.0f;
+	c->initial[ k ] = initial;
+	c->range[ k ] = final == PARTICLES_SAME_AS_INITIAL ? 0.0f : final - initial;
+}
+
+/*
+===============
+CG_LinkParticle
+
+Add a fully spawned particle to the live list
+===============
+*/
+static void CG_LinkParticle( particle_t *p )
+{
+	p->liveIndex = particleStore.numLive++;
+	particleStore.live[ p->liveIndex ] = p;
+
+	CG_SetParticleChannel( PCH_TIME, p, 0, 0.0f, 1.0f );
+	CG_SetParticleChannel( PCH_RADIUS, p, p->radius.delay, p->radius.initial, p->radius.final );
+	CG_SetParticleChannel( PCH_ALPHA, p, p->alpha.delay, p->alpha.initial, p->alpha.final );
+	CG_SetParticleChannel( PCH_ROTATION, p, p->rotation.delay, p->rotation.initial, p->rotation.final );
+	CG_SetParticleChannel( PCH_COLOR, p, p->colorDelay, 0.0f, 1.0f );
+	CG_SetParticleChannel( PCH_DLIGHT_RADIUS, p, p->dLightRadius.delay,
+	                       p->dLightRadius.initial, p->dLightRadius.final );
+
+	p->parent->numLiveParticles++;
+}
+
+/*
+===============
+CG_UnlinkDeadParticles
+
+Remove destroyed particles from the live list and queue their slots for reuse
+===============
+*/
+static void CG_UnlinkDeadParticles()
+{
+	int k = 0;
+
+	while ( k < particleStore.numLive )
+	{
+		particle_t *p = particleStore.live[ k ];
+		int        last, ch;
+
+		if ( p->valid )
+		{
+			k++;
+			continue;
+		}
+
+		//move the last live particle into the hole
+		last = --particleStore.numLive;
+
+		if ( k != last )
+		{
+			particleStore.live[ k ] = particleStore.live[ last ];
+			particleStore.live[ k ]->liveIndex = k;
+
+			for ( ch = 0; ch < PCH_NUM_CHANNELS; ch++ )
+			{
+				particleChannelData_t *c = &particleStore.channels[ ch ];
+
+				c->start[ k ] = c->start[ last ];
+				c->invDuration[ k ] = c->invDuration[ last ];
+				c->initial[ k ] = c->initial[ last ];
+				c->range[ k ] = c->range[ last ];
+			}
+		}
+
+		p->liveIndex = -1;
+		particleStore.released[ ( particleStore.releasedHead + particleStore.numReleased ) % MAX_PARTICLES ] =
+		  p - particles;
+		particleStore.numReleased++;
+	}
+}
+
+/*
+===============
+CG_LerpParticles
+
+Evaluate the interpolated values of all live particles for cg.time
+===============
+*/
+static void CG_LerpParticles()
+{
+	int ch, k;
+
+	for ( ch = 0; ch < PCH_NUM_CHANNELS; ch++ )
+	{
+		particleChannelData_t *c = &particleStore.channels[ ch ];
+
+		for ( k = 0; k < particleStore.numLive; k++ )
+		{
+			float frac = ( float )( cg.time - c->start[ k ] ) * c->invDuration[ k ];
+
+			frac = std::min( std::max( frac, 0.0f ), 1.0f );
+			c->value[ k ] = c->initial[ k ] + frac * c->range[ k ];
+		}
+	}
+}
+
+/*
+===============
+CG_ParticleValue
+
+Interpolated value of a live particle, valid after CG_LerpParticles
+===============
+*/
+static inline float CG_ParticleValue( const particle_t *p, int channel )
+{
+	return particleStore.channels[ channel ].value[ p->liveIndex ];
+}
+
 /*
 ===============
 CG_LerpValues
@@ -125,6 +453,7 @@ static void CG_DestroyParticle( particle_t *p, vec3_t impactNormal )
 	}
 
 	p->valid = false;
+	p->parent->numLiveParticles--;
 
 	//this gives other systems a couple of
 	//frames to realise the particle is gone
@@ -140,222 +469,223 @@ Introduce a new particle into the world
 */
 static particle_t *CG_SpawnNewParticle( baseParticle_t *bp, particleEjector_t *parent )
 {
-	int               i, j;
-	particle_t        *p = nullptr;
+	int               j;
+	particle_t        *p;
 	particleEjector_t *pe = parent;
 	particleSystem_t  *ps = parent->parent;
 	vec3_t            attachmentPoint, attachmentVelocity;
 	vec3_t            transform[ 3 ];
 
-	for ( i = 0; i < MAX_PARTICLES; i++ )
+	p = CG_AllocParticle();
+
+	if ( !p )
 	{
-		p = &particles[ i ];
+		return nullptr;
+	}
 
-		//FIXME: the + 1 may be unnecessary
-		if ( !p->valid && cg.clientFrame > p->frameWhenInvalidated + 1 )
-		{
-			memset( p, 0, sizeof( particle_t ) );
+	p->class_ = bp;
+	p->parent = pe;
 
-			//found a free slot
-			p->class_ = bp;
-			p->parent = pe;
+	p->birthTime = cg.time;
+	p->lifeTime = ( int ) CG_RandomiseValue( ( float ) bp->lifeTime, bp->lifeTimeRandFrac );
 
-			p->birthTime = cg.time;
-			p->lifeTime = ( int ) CG_RandomiseValue( ( float ) bp->lifeTime, bp->lifeTimeRandFrac );
+	p->radius.delay = ( int ) CG_RandomiseValue( ( float ) bp->radius.delay, bp->radius.delayRandFrac );
+	p->radius.initial = CG_RandomiseValue( bp->radius.initial, bp->radius.initialRandFrac );
+	p->radius.final = CG_RandomiseValue( bp->radius.final, bp->radius.finalRandFrac );
 
-			p->radius.delay = ( int ) CG_RandomiseValue( ( float ) bp->radius.delay, bp->radius.delayRandFrac );
-			p->radius.initial = CG_RandomiseValue( bp->radius.initial, bp->radius.initialRandFrac );
-			p->radius.final = CG_RandomiseValue( bp->radius.final, bp->radius.finalRandFrac );
+	p->radius.initial += bp->scaleWithCharge * pe->parent->charge;
 
-			p->radius.initial += bp->scaleWithCharge * pe->parent->charge;
+	p->alpha.delay = ( int ) CG_RandomiseValue( ( float ) bp->alpha.delay, bp->alpha.delayRandFrac );
+	p->alpha.initial = CG_RandomiseValue( bp->alpha.initial, bp->alpha.initialRandFrac );
+	p->alpha.final = CG_RandomiseValue( bp->alpha.final, bp->alpha.finalRandFrac );
 
-			p->alpha.delay = ( int ) CG_RandomiseValue( ( float ) bp->alpha.delay, bp->alpha.delayRandFrac );
-			p->alpha.initial = CG_RandomiseValue( bp->alpha.initial, bp->alpha.initialRandFrac );
-			p->alpha.final = CG_RandomiseValue( bp->alpha.final, bp->alpha.finalRandFrac );
+	p->rotation.delay = ( int ) CG_RandomiseValue( ( float ) bp->rotation.delay, bp->rotation.delayRandFrac );
+	p->rotation.initial = CG_RandomiseValue( bp->rotation.initial, bp->rotation.initialRandFrac );
+	p->rotation.final = CG_RandomiseValue( bp->rotation.final, bp->rotation.finalRandFrac );
 
-			p->rotation.delay = ( int ) CG_RandomiseValue( ( float ) bp->rotation.delay, bp->rotation.delayRandFrac );
-			p->rotation.initial = CG_RandomiseValue( bp->rotation.initial, bp->rotation.initialRandFrac );
-			p->rotation.final = CG_RandomiseValue( bp->rotation.final, bp->rotation.finalRandFrac );
+	p->dLightRadius.delay =
+	  ( int ) CG_RandomiseValue( ( float ) bp->dLightRadius.delay, bp->dLightRadius.delayRandFrac );
+	p->dLightRadius.initial =
+	  CG_RandomiseValue( bp->dLightRadius.initial, bp->dLightRadius.initialRandFrac );
+	p->dLightRadius.final =
+	  CG_RandomiseValue( bp->dLightRadius.final, bp->dLightRadius.finalRandFrac );
 
-			p->dLightRadius.delay =
-			  ( int ) CG_RandomiseValue( ( float ) bp->dLightRadius.delay, bp->dLightRadius.delayRandFrac );
-			p->dLightRadius.initial =
-			  CG_RandomiseValue( bp->dLightRadius.initial, bp->dLightRadius.initialRandFrac );
-			p->dLightRadius.final =
-			  CG_RandomiseValue( bp->dLightRadius.final, bp->dLightRadius.finalRandFrac );
+	p->colorDelay = CG_RandomiseValue( bp->colorDelay, bp->colorDelayRandFrac );
 
-			p->colorDelay = CG_RandomiseValue( bp->colorDelay, bp->colorDelayRandFrac );
+	p->bounceMarkRadius = CG_RandomiseValue( bp->bounceMarkRadius, bp->bounceMarkRadiusRandFrac );
+	p->bounceMarkCount =
+	  rint( CG_RandomiseValue( ( float ) bp->bounceMarkCount, bp->bounceMarkCountRandFrac ) );
+	p->bounceSoundCount =
+	  rint( CG_RandomiseValue( ( float ) bp->bounceSoundCount, bp->bounceSoundCountRandFrac ) );
 
-			p->bounceMarkRadius = CG_RandomiseValue( bp->bounceMarkRadius, bp->bounceMarkRadiusRandFrac );
-			p->bounceMarkCount =
-			  rint( CG_RandomiseValue( ( float ) bp->bounceMarkCount, bp->bounceMarkCountRandFrac ) );
-			p->bounceSoundCount =
-			  rint( CG_RandomiseValue( ( float ) bp->bounceSoundCount, bp->bounceSoundCountRandFrac ) );
+	if ( bp->numModels )
+	{
+		p->model = bp->models[ rand() % bp->numModels ];
 
-			if ( bp->numModels )
-			{
-				p->model = bp->models[ rand() % bp->numModels ];
+		if ( bp->modelAnimation.frameLerp < 0 )
+		{
+			bp->modelAnimation.frameLerp = p->lifeTime / bp->modelAnimation.numFrames;
+			bp->modelAnimation.initialLerp = p->lifeTime / bp->modelAnimation.numFrames;
+		}
+	}
 
-				if ( bp->modelAnimation.frameLerp < 0 )
-				{
-					bp->modelAnimation.frameLerp = p->lifeTime / bp->modelAnimation.numFrames;
-					bp->modelAnimation.initialLerp = p->lifeTime / bp->modelAnimation.numFrames;
-				}
-			}
+	if ( !CG_AttachmentPoint( &ps->attachment, attachmentPoint ) )
+	{
+		CG_FreeParticle( p );
+		return nullptr;
+	}
 
-			if ( !CG_AttachmentPoint( &ps->attachment, attachmentPoint ) )
-			{
-				return nullptr;
-			}
+	VectorCopy( attachmentPoint, p->origin );
 
-			VectorCopy( attachmentPoint, p->origin );
+	if ( CG_AttachmentAxis( &ps->attachment, transform ) )
+	{
+		vec3_t transDisplacement;
 
-			if ( CG_AttachmentAxis( &ps->attachment, transform ) )
-			{
-				vec3_t transDisplacement;
+		VectorMatrixMultiply( bp->displacement, transform, transDisplacement );
+		VectorAdd( p->origin, transDisplacement, p->origin );
+	}
+	else
+	{
+		VectorAdd( p->origin, bp->displacement, p->origin );
+	}
+
+	for ( j = 0; j <= 2; j++ )
+	{
+		p->origin[ j ] += ( crandom() * bp->randDisplacement[ j ] );
+	}
 
-				VectorMatrixMultiply( bp->displacement, transform, transDisplacement );
-				VectorAdd( p->origin, transDisplacement, p->origin );
+	switch ( bp->velMoveType )
+	{
+		case PMT_STATIC:
+			if ( bp->velMoveValues.dirType == PMD_POINT )
+			{
+				VectorSubtract( bp->velMoveValues.point, p->origin, p->velocity );
 			}
-			else
+			else if ( bp->velMoveValues.dirType == PMD_LINEAR )
 			{
-				VectorAdd( p->origin, bp->displacement, p->origin );
+				VectorCopy( bp->velMoveValues.dir, p->velocity );
 			}
 
-			for ( j = 0; j <= 2; j++ )
+			break;
+
+		case PMT_STATIC_TRANSFORM:
+			if ( !CG_AttachmentAxis( &ps->attachment, transform ) )
 			{
-				p->origin[ j ] += ( crandom() * bp->randDisplacement[ j ] );
+				CG_FreeParticle( p );
+				return nullptr;
 			}
 
-			switch ( bp->velMoveType )
+			if ( bp->velMoveValues.dirType == PMD_POINT )
 			{
-				case PMT_STATIC:
-					if ( bp->velMoveValues.dirType == PMD_POINT )
-					{
-						VectorSubtract( bp->velMoveValues.point, p->origin, p->velocity );
-					}
-					else if ( bp->velMoveValues.dirType == PMD_LINEAR )
-					{
-						VectorCopy( bp->velMoveValues.dir, p->velocity );
-					}
-
-					break;
-
-				case PMT_STATIC_TRANSFORM:
-					if ( !CG_AttachmentAxis( &ps->attachment, transform ) )
-					{
-						return nullptr;
-					}
-
-					if ( bp->velMoveValues.dirType == PMD_POINT )
-					{
-						vec3_t transPoint;
-
-						VectorMatrixMultiply( bp->velMoveValues.point, transform, transPoint );
-						VectorSubtract( transPoint, p->origin, p->velocity );
-					}
-					else if ( bp->velMoveValues.dirType == PMD_LINEAR )
-					{
-						VectorMatrixMultiply( bp->velMoveValues.dir, transform, p->velocity );
-					}
-
-					break;
+				vec3_t transPoint;
 
-				case PMT_TAG:
-				case PMT_CENT_ANGLES:
-					if ( bp->velMoveValues.dirType == PMD_POINT )
-					{
-						VectorSubtract( attachmentPoint, p->origin, p->velocity );
-					}
-					else if ( bp->velMoveValues.dirType == PMD_LINEAR )
-					{
-						if ( !CG_AttachmentDir( &ps->attachment, p->velocity ) )
-						{
-							return nullptr;
-						}
-					}
+				VectorMatrixMultiply( bp->velMoveValues.point, transform, transPoint );
+				VectorSubtract( transPoint, p->origin, p->velocity );
+			}
+			else if ( bp->velMoveValues.dirType == PMD_LINEAR )
+			{
+				VectorMatrixMultiply( bp->velMoveValues.dir, transform, p->velocity );
+			}
 
-					break;
+			break;
 
-				case PMT_NORMAL:
-					if ( !ps->normalValid )
-					{
-						Log::Warn("a particle with velocityType "
-						           "normal has no normal" );
-						return nullptr;
-					}
+		case PMT_TAG:
+		case PMT_CENT_ANGLES:
+			if ( bp->velMoveValues.dirType == PMD_POINT )
+			{
+				VectorSubtract( attachmentPoint, p->origin, p->velocity );
+			}
+			else if ( bp->velMoveValues.dirType == PMD_LINEAR )
+			{
+				if ( !CG_AttachmentDir( &ps->attachment, p->velocity ) )
+				{
+					CG_FreeParticle( p );
+					return nullptr;
+				}
+			}
 
-					VectorCopy( ps->normal, p->velocity );
+			break;
 
-					//normal displacement
-					VectorNormalize( p->velocity );
-					VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
-					break;
+		case PMT_NORMAL:
+			if ( !ps->normalValid )
+			{
+				Log::Warn("a particle with velocityType "
+				           "normal has no normal" );
+				CG_FreeParticle( p );
+				return nullptr;
+			}
 
-				case PMT_LAST_NORMAL:
-					VectorCopy( ps->lastNormal, p->velocity );
-					VectorNormalize( p->velocity );
-					VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
-					break;
+			VectorCopy( ps->normal, p->velocity );
 
-				case PMT_OPPORTUNISTIC_NORMAL:
-					if ( ps->lastNormalIsCurrent )
-					{
-						VectorCopy( ps->lastNormal, p->velocity );
-						VectorNormalize( p->velocity );
-						VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
-					}
-					break;
-			}
+			//normal displacement
+			VectorNormalize( p->velocity );
+			VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
+			break;
 
+		case PMT_LAST_NORMAL:
+			VectorCopy( ps->lastNormal, p->velocity );
 			VectorNormalize( p->velocity );
-			CG_SpreadVector( p->velocity, bp->velMoveValues.dirRandAngle );
-			VectorScale( p->velocity,
-			             CG_RandomiseValue( bp->velMoveValues.mag, bp->velMoveValues.magRandFrac ),
-			             p->velocity );
+			VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
+			break;
 
-			if ( CG_AttachmentVelocity( &ps->attachment, attachmentVelocity ) )
+		case PMT_OPPORTUNISTIC_NORMAL:
+			if ( ps->lastNormalIsCurrent )
 			{
-				VectorMA( p->velocity,
-				          CG_RandomiseValue( bp->velMoveValues.parentVelFrac,
-				                             bp->velMoveValues.parentVelFracRandFrac ), attachmentVelocity, p->velocity );
+				VectorCopy( ps->lastNormal, p->velocity );
+				VectorNormalize( p->velocity );
+				VectorMA( p->origin, bp->normalDisplacement, p->velocity, p->origin );
 			}
+			break;
+	}
 
-			p->lastEvalTime = cg.time;
+	VectorNormalize( p->velocity );
+	CG_SpreadVector( p->velocity, bp->velMoveValues.dirRandAngle );
+	VectorScale( p->velocity,
+	             CG_RandomiseValue( bp->velMoveValues.mag, bp->velMoveValues.magRandFrac ),
+	             p->velocity );
 
-			p->valid = true;
+	if ( CG_AttachmentVelocity( &ps->attachment, attachmentVelocity ) )
+	{
+		VectorMA( p->velocity,
+		          CG_RandomiseValue( bp->velMoveValues.parentVelFrac,
+		                             bp->velMoveValues.parentVelFracRandFrac ), attachmentVelocity, p->velocity );
+	}
 
-			//this particle has a child particle system attached
-			if ( bp->childSystemName[ 0 ] != '\0' )
-			{
-				particleSystem_t *chps = CG_SpawnNewParticleSystem( bp->childSystemHandle );
+	p->lastEvalTime = cg.time;
 
-				if ( CG_IsParticleSystemValid( &chps ) )
-				{
-					CG_SetAttachmentParticle( &chps->attachment, p );
-					CG_AttachToParticle( &chps->attachment );
-					p->childParticleSystem = chps;
-
-					if ( ps->lastNormalIsCurrent )
-						CG_SetParticleSystemLastNormal( chps, ps->lastNormal );
-					else
-						VectorCopy( ps->lastNormal, chps->lastNormal );
-				}
-			}
+	VectorCopy( p->origin, p->traceOrigin );
+	p->lastTraceFrame = cg.clientFrame;
 
-			//this particle has a child trail system attached
-			if ( bp->childTrailSystemName[ 0 ] != '\0' )
-			{
-				trailSystem_t *ts = CG_SpawnNewTrailSystem( bp->childTrailSystemHandle );
+	p->valid = true;
+	CG_LinkParticle( p );
 
-				if ( CG_IsTrailSystemValid( &ts ) )
-				{
-					CG_SetAttachmentParticle( &ts->frontAttachment, p );
-					CG_AttachToParticle( &ts->frontAttachment );
-				}
-			}
+	//this particle has a child particle system attached
+	if ( bp->childSystemName[ 0 ] != '\0' )
+	{
+		particleSystem_t *chps = CG_SpawnNewParticleSystem( bp->childSystemHandle );
 
-			break;
+		if ( CG_IsParticleSystemValid( &chps ) )
+		{
+			CG_SetAttachmentParticle( &chps->attachment, p );
+			CG_AttachToParticle( &chps->attachment );
+			p->childParticleSystem = chps;
+
+			if ( ps->lastNormalIsCurrent )
+				CG_SetParticleSystemLastNormal( chps, ps->lastNormal );
+			else
+				VectorCopy( ps->lastNormal, chps->lastNormal );
+		}
+	}
+
+	//this particle has a child trail system attached
+	if ( bp->childTrailSystemName[ 0 ] != '\0' )
+	{
+		trailSystem_t *ts = CG_SpawnNewTrailSystem( bp->childTrailSystemHandle );
+
+		if ( CG_IsTrailSystemValid( &ts ) )
+		{
+			CG_SetAttachmentParticle( &ts->frontAttachment, p );
+			CG_AttachToParticle( &ts->frontAttachment );
 		}
 	}
 
@@ -373,14 +703,12 @@ introducing new particles
 static void CG_SpawnNewParticles()
 {
 	int                   i, j;
-	particle_t            *p;
 	particleSystem_t      *ps;
 	particleEjector_t     *pe;
 	baseParticleEjector_t *bpe;
 	float                 lerpFrac;
-	int                   count;
 
-	for ( i = 0; i < MAX_PARTICLE_EJECTORS; i++ )
+	for ( i = 0; i < numParticleEjectorSlots; i++ )
 	{
 		pe = &particleEjectors[ i ];
 		ps = pe->parent;
@@ -421,28 +749,19 @@ static void CG_SpawnNewParticles()
 				}
 			}
 
-			if ( pe->count == 0 || ps->lazyRemove )
+			//wait for child particles to die before declaring this pe invalid
+			if ( ( pe->count == 0 || ps->lazyRemove ) && !pe->numLiveParticles )
 			{
-				count = 0;
-
-				//wait for child particles to die before declaring this pe invalid
-				for ( j = 0; j < MAX_PARTICLES; j++ )
-				{
-					p = &particles[ j ];
-
-					if ( p->valid && p->parent == pe )
-					{
-						count++;
-					}
-				}
-
-				if ( !count )
-				{
-					pe->valid = false;
-				}
+				pe->valid = false;
+				ps->numLiveEjectors--;
 			}
 		}
 	}
+
+	while ( numParticleEjectorSlots > 0 && !particleEjectors[ numParticleEjectorSlots - 1 ].valid )
+	{
+		numParticleEjectorSlots--;
+	}
 }
 
 /*
@@ -481,6 +800,8 @@ static particleEjector_t *CG_SpawnNewParticleEjector( baseParticleEjector_t *bpe
 			              ( int ) rint( CG_RandomiseValue( ( float ) bpe->totalParticles, bpe->totalParticlesRandFrac ) );
 
 			pe->valid = true;
+			ps->numLiveEjectors++;
+			numParticleEjectorSlots = std::max( numParticleEjectorSlots, i + 1 );
 
 			if ( cg_debugParticles.integer >= 1 )
 			{
@@ -503,7 +824,7 @@ Allocate a new particle system
 */
 particleSystem_t *CG_SpawnNewParticleSystem( qhandle_t psHandle )
 {
-	int                  i, j;
+	int                  i, j, limit;
 	particleSystem_t     *ps = nullptr;
 	baseParticleSystem_t *bps = &baseParticleSystems[ psHandle - 1 ];
 
@@ -513,7 +834,9 @@ particleSystem_t *CG_SpawnNewParticleSystem( qhandle_t psHandle )
 		return nullptr;
 	}
 
-	for ( i = 0; i < MAX_PARTICLE_SYSTEMS; i++ )
+	limit = Math::Clamp( cg_particleSystemLimit.integer, 1, MAX_PARTICLE_SYSTEMS );
+
+	for ( i = 0; i < limit; i++ )
 	{
 		ps = &particleSystems[ i ];
 
@@ -526,6 +849,7 @@ particleSystem_t *CG_SpawnNewParticleSystem( qhandle_t psHandle )
 
 			ps->valid = true;
 			ps->lazyRemove = false;
+			numParticleSystemSlots = std::max( numParticleSystemSlots, i + 1 );
 
 			// use "up" as an arbitrary (non-null) "last" normal
 			VectorSet( ps->lastNormal, 0, 0, 1 );
@@ -1843,6 +2167,8 @@ void CG_LoadParticleSystems()
 	numBaseParticleEjectors = 0;
 	numBaseParticles = 0;
 
+	CG_ResetParticleStorage();
+
 	for ( i = 0; i < MAX_BASEPARTICLE_SYSTEMS; i++ )
 	{
 		baseParticleSystem_t *bps = &baseParticleSystems[ i ];
@@ -2004,7 +2330,7 @@ void CG_DestroyParticleSystem( particleSystem_t **ps )
 		Log::Debug( "PS destroyed" );
 	}
 
-	for ( i = 0; i < MAX_PARTICLE_EJECTORS; i++ )
+	for ( i = 0; i < numParticleEjectorSlots; i++ )
 	{
 		pe = &particleEjectors[ i ];
 
@@ -2047,7 +2373,7 @@ bool CG_IsParticleSystemInfinite( particleSystem_t *ps )
 		return false;
 	}
 
-	for ( i = 0; i < MAX_PARTICLE_EJECTORS; i++ )
+	for ( i = 0; i < numParticleEjectorSlots; i++ )
 	{
 		pe = &particleEjectors[ i ];
 
@@ -2094,15 +2420,13 @@ Destroy inactive particle systems
 */
 static void CG_GarbageCollectParticleSystems()
 {
-	int               i, j, count;
-	particleSystem_t  *ps;
-	particleEjector_t *pe;
-	int               centNum;
+	int              i;
+	particleSystem_t *ps;
+	int              centNum;
 
-	for ( i = 0; i < MAX_PARTICLE_SYSTEMS; i++ )
+	for ( i = 0; i < numParticleSystemSlots; i++ )
 	{
 		ps = &particleSystems[ i ];
-		count = 0;
 
 		//don't bother checking already invalid systems
 		if ( !ps->valid )
@@ -2110,17 +2434,7 @@ static void CG_GarbageCollectParticleSystems()
 			continue;
 		}
 
-		for ( j = 0; j < MAX_PARTICLE_EJECTORS; j++ )
-		{
-			pe = &particleEjectors[ j ];
-
-			if ( pe->valid && pe->parent == ps )
-			{
-				count++;
-			}
-		}
-
-		if ( !count )
+		if ( !ps->numLiveEjectors )
 		{
 			ps->valid = false;
 		}
@@ -2141,31 +2455,143 @@ static void CG_GarbageCollectParticleSystems()
 			Log::Debug( "PS %s garbage collected", ps->class_->name );
 		}
 	}
+
+	while ( numParticleSystemSlots > 0 && !particleSystems[ numParticleSystemSlots - 1 ].valid )
+	{
+		numParticleSystemSlots--;
+	}
 }
 
 /*
 ===============
-CG_CalculateTimeFrac
+CG_ParticlePointContents
 
-Calculate the fraction of time passed
+Like trap_CM_PointContents, but only meant for CONTENTS_SOLID and
+CONTENTS_NODROP tests as it reports nothing for cells without either
 ===============
 */
-static float CG_CalculateTimeFrac( int birth, int life, int delay )
+static int CG_ParticlePointContents( const vec3_t point )
 {
-	float frac;
+	int            x = ( int ) floorf( point[ 0 ] / PARTICLE_CELL_SIZE );
+	int            y = ( int ) floorf( point[ 1 ] / PARTICLE_CELL_SIZE );
+	int            z = ( int ) floorf( point[ 2 ] / PARTICLE_CELL_SIZE );
+	unsigned       hash = ( unsigned ) x * 73856093u ^ ( unsigned ) y * 19349663u ^ ( unsigned ) z * 83492791u;
+	particleCell_t *cell = &particleCells[ hash & ( PARTICLE_CELL_CACHE - 1 ) ];
 
-	frac = ( ( float ) cg.time - ( float )( birth + delay ) ) / ( float )( life - delay );
+	if ( cell->state == PCELL_UNKNOWN || cell->x != x || cell->y != y || cell->z != z )
+	{
+		vec3_t  center, mins, maxs;
+		trace_t trace;
+
+		VectorSet( center, ( x + 0.5f ) * PARTICLE_CELL_SIZE, ( y + 0.5f ) * PARTICLE_CELL_SIZE,
+		           ( z + 0.5f ) * PARTICLE_CELL_SIZE );
+		VectorSet( maxs, PARTICLE_CELL_SIZE / 2, PARTICLE_CELL_SIZE / 2, PARTICLE_CELL_SIZE / 2 );
+		VectorNegate( maxs, mins );
+
+		trap_CM_BoxTrace( &trace, center, center, mins, maxs, 0, CONTENTS_SOLID | CONTENTS_NODROP, 0 );
 
-	if ( frac < 0.0f )
+		cell->x = x;
+		cell->y = y;
+		cell->z = z;
+		cell->state = ( trace.startsolid || trace.allsolid ) ? PCELL_OCCUPIED : PCELL_EMPTY;
+		particleTraceCounts.cellTests++;
+	}
+
+	if ( cell->state == PCELL_EMPTY )
 	{
-		frac = 0.0f;
+		particleTraceCounts.cellHits++;
+		return 0;
 	}
-	else if ( frac > 1.0f )
+
+	particleTraceCounts.contents++;
+	return trap_CM_PointContents( point, 0 );
+}
+
+/*
+===============
+CG_ParticleCanBounce
+
+Whether particles of this type ever need a collision trace
+===============
+*/
+static bool CG_ParticleCanBounce( const baseParticle_t *bp )
+{
+	return bp->bounceFrac != 0.0f || bp->bounceFracRandFrac != 0.0f;
+}
+
+/*
+===============
+CG_ScheduleParticleTraces
+
+Decide which live particles get a collision trace this frame
+===============
+*/
+static void CG_ScheduleParticleTraces()
+{
+	static particle_t *candidates[ MAX_PARTICLES ];
+	int               numCandidates = 0;
+	int               budget = cg_particleTraceBudget.integer;
+	int               interval = std::max( cg_particleTraceInterval.integer, 1 );
+	float             nearDistSquared = Square( cg_particleTraceNearDistance.value );
+	int               i;
+
+	for ( i = 0; i < particleStore.numLive; i++ )
 	{
-		frac = 1.0f;
+		particle_t *p = particleStore.live[ i ];
+		float      distSquared;
+		int        waited;
+
+		p->traceThisFrame = false;
+
+		if ( !cg_bounceParticles.integer || p->atRest || !CG_ParticleCanBounce( p->class_ ) )
+		{
+			continue;
+		}
+
+		distSquared = DistanceSquared( p->origin, cg.refdef.vieworg );
+
+		//keep collisions near the view exact
+		if ( distSquared <= nearDistSquared )
+		{
+			p->traceThisFrame = true;
+			budget--;
+			continue;
+		}
+
+		waited = cg.clientFrame - p->lastTraceFrame;
+
+		if ( waited < interval )
+		{
+			particleTraceCounts.deferred++;
+			continue;
+		}
+
+		p->tracePriority = distSquared / Square( ( float ) waited );
+		candidates[ numCandidates++ ] = p;
 	}
 
-	return frac;
+	//no budget means no limit
+	if ( cg_particleTraceBudget.integer <= 0 || numCandidates <= budget )
+	{
+		budget = numCandidates;
+	}
+	else
+	{
+		budget = std::max( budget, 0 );
+
+		std::nth_element( candidates, candidates + budget, candidates + numCandidates,
+		                  []( const particle_t *a, const particle_t *b )
+		                  {
+		                      return a->tracePriority < b->tracePriority;
+		                  } );
+
+		particleTraceCounts.deferred += numCandidates - budget;
+	}
+
+	for ( i = 0; i < budget; i++ )
+	{
+		candidates[ i ]->traceThisFrame = true;
+	}
 }
 
 /*
@@ -2312,9 +2738,7 @@ static void CG_EvaluateParticlePhysics( particle_t *p )
 	}
 	else
 	{
-		radius = CG_LerpValues( p->radius.initial, p->radius.final,
-		                        CG_CalculateTimeFrac( p->birthTime, p->lifeTime,
-		                            p->radius.delay ) );
+		radius = CG_ParticleValue( p, PCH_RADIUS );
 	}
 
 	VectorSet( mins, -radius, -radius, -radius );
@@ -2330,7 +2754,7 @@ static void CG_EvaluateParticlePhysics( particle_t *p )
 	// we're not doing particle physics, but at least cull them in solids
 	if ( !cg_bounceParticles.integer )
 	{
-		int contents = trap_CM_PointContents( newOrigin, 0 );
+		int contents = CG_ParticlePointContents( newOrigin );
 
 		if ( ( contents & CONTENTS_SOLID ) || ( contents & CONTENTS_NODROP ) )
 		{
@@ -2344,20 +2768,39 @@ static void CG_EvaluateParticlePhysics( particle_t *p )
 		return;
 	}
 
-	CG_Trace( &trace, p->origin, mins, maxs, newOrigin, CG_AttachmentCentNum( &ps->attachment ),
+	//not a collider
+	if ( !CG_ParticleCanBounce( bp ) )
+	{
+		VectorCopy( newOrigin, p->origin );
+		if ( CG_IsParticleSystemValid( &p->childParticleSystem ) )
+			CG_SetParticleSystemLastNormal( p->childParticleSystem, nullptr );
+		return;
+	}
+
+	//no trace this frame, the next one covers the distance moved
+	if ( !p->traceThisFrame )
+	{
+		VectorCopy( newOrigin, p->origin );
+		return;
+	}
+
+	CG_Trace( &trace, p->traceOrigin, mins, maxs, newOrigin, CG_AttachmentCentNum( &ps->attachment ),
 	          CONTENTS_SOLID, 0 );
+	p->lastTraceFrame = cg.clientFrame;
+	particleTraceCounts.traces++;
 
-	//not hit anything or not a collider
+	//not hit anything
 	if ( trace.fraction == 1.0f || bounce == 0.0f )
 	{
 		VectorCopy( newOrigin, p->origin );
+		VectorCopy( newOrigin, p->traceOrigin );
 		if ( CG_IsParticleSystemValid( &p->childParticleSystem ) )
 			CG_SetParticleSystemLastNormal( p->childParticleSystem, nullptr );
 		return;
 	}
 
 	//remove particles that get into a CONTENTS_NODROP brush
-	if ( ( trap_CM_PointContents( trace.endpos, 0 ) & CONTENTS_NODROP ) ||
+	if ( ( CG_ParticlePointContents( trace.endpos ) & CONTENTS_NODROP ) ||
 	     ( bp->cullOnStartSolid && trace.startsolid ) )
 	{
 		CG_DestroyParticle( p, nullptr );
@@ -2396,6 +2839,7 @@ static void CG_EvaluateParticlePhysics( particle_t *p )
 	}
 
 	VectorCopy( trace.endpos, p->origin );
+	VectorCopy( trace.endpos, p->traceOrigin );
 
 	if ( !trace.allsolid )
 	{
@@ -2454,69 +2898,118 @@ static void CG_RadixSort( particle_t **source, particle_t **temp, int size )
 
 /*
 ===============
-CG_CompactAndSortParticles
+CG_ParticleNeedsBlending
 
-Depth sort the particles
+Sprites are blended and have to be drawn back to front, models are not
 ===============
 */
-static void CG_CompactAndSortParticles()
+static bool CG_ParticleNeedsBlending( const particle_t *p )
 {
-	int    i, j = 0;
-	int    numParticles;
-	vec3_t delta;
+	return p->class_->numFrames != 0;
+}
 
-	for ( i = 0; i < MAX_PARTICLES; i++ )
-	{
-		sortedParticles[ i ] = &particles[ i ];
-	}
+/*
+===============
+CG_ParticleSortKey
 
-	if ( !cg_depthSortParticles.integer )
-	{
-		return;
-	}
+Sort key that puts far particles first
+===============
+*/
+static unsigned CG_ParticleSortKey( const particle_t *p )
+{
+	vec3_t   delta;
+	float    distSquared;
+	unsigned bits;
+
+	VectorSubtract( p->origin, cg.refdef.vieworg, delta );
+	distSquared = DotProduct( delta, delta );
+
+	//non-negative floats order like their bit patterns
+	memcpy( &bits, &distSquared, sizeof( bits ) );
+
+	return ~bits;
+}
+
+static bool CG_CompareParticleSortKeys( const particle_t *a, const particle_t *b )
+{
+	return a->sortKey < b->sortKey;
+}
+
+/*
+===============
+CG_SortParticles
+
+Depth sort the blended particles back to front into sortedParticles and
+return how many there are. While the view stays nearly still the order from
+the previous frame is kept and only new particles are merged into it.
+===============
+*/
+static int CG_SortParticles()
+{
+	int        i, numOld = 0, numNew = 0;
+	particle_t *p;
 
-	for ( i = MAX_PARTICLES - 1; i >= 0; i-- )
+	if ( cg.clientFrame - particleSort.frame >= PARTICLE_SORT_MAX_FRAMES ||
+	     DistanceSquared( cg.refdef.vieworg, particleSort.origin ) > Square( PARTICLE_SORT_MAX_MOVE ) ||
+	     DotProduct( cg.refdef.viewaxis[ 0 ], particleSort.forward ) < PARTICLE_SORT_MIN_DOT )
 	{
-		if ( sortedParticles[ i ]->valid )
+		//full sort, particles sorted so far are no longer trusted
+		particleSort.generation++;
+		particleSort.frame = cg.clientFrame;
+		VectorCopy( cg.refdef.vieworg, particleSort.origin );
+		VectorCopy( cg.refdef.viewaxis[ 0 ], particleSort.forward );
+
+		for ( i = 0; i < particleStore.numLive; i++ )
 		{
-			//find the first hole
-			while ( j < MAX_PARTICLES && sortedParticles[ j ]->valid )
-			{
-				j++;
-			}
+			p = particleStore.live[ i ];
 
-			//no more holes
-			if ( j >= i )
+			if ( p->valid && CG_ParticleNeedsBlending( p ) )
 			{
-				break;
+				p->sortKey = CG_ParticleSortKey( p );
+				p->sortGeneration = particleSort.generation;
+				sortedParticles[ numOld++ ] = p;
 			}
-
-			sortedParticles[ j ] = sortedParticles[ i ];
 		}
-	}
 
-	numParticles = i;
+		CG_RadixSort( sortedParticles, radixBuffer, numOld );
 
-	//set sort keys
-	for ( i = 0; i < numParticles; i++ )
-	{
-		VectorSubtract( sortedParticles[ i ]->origin, cg.refdef.vieworg, delta );
-		sortedParticles[ i ]->sortKey = ( int ) DotProduct( delta, delta );
+		particleSort.numSorted = numOld;
+		return numOld;
 	}
 
-	CG_RadixSort( sortedParticles, radixBuffer, numParticles );
+	//keep the previous order of particles that are still around, a reused
+	//slot was cleared and doesn't carry the generation any more
+	for ( i = 0; i < particleSort.numSorted; i++ )
+	{
+		p = sortedParticles[ i ];
 
-	//FIXME: wtf?
-	//reverse order of particles array
-	for ( i = 0; i < numParticles; i++ )
+		if ( p->valid && p->sortGeneration == particleSort.generation )
+		{
+			sortedParticles[ numOld++ ] = p;
+		}
+	}
+
+	for ( i = 0; i < particleStore.numLive; i++ )
 	{
-		radixBuffer[ i ] = sortedParticles[ numParticles - i - 1 ];
+		p = particleStore.live[ i ];
+
+		if ( p->valid && p->sortGeneration != particleSort.generation && CG_ParticleNeedsBlending( p ) )
+		{
+			p->sortKey = CG_ParticleSortKey( p );
+			p->sortGeneration = particleSort.generation;
+			sortedParticles[ numOld + numNew++ ] = p;
+		}
 	}
 
-	for ( i = 0; i < numParticles; i++ )
+	if ( numNew )
 	{
-		sortedParticles[ i ] = radixBuffer[ i ];
+		std::sort( sortedParticles + numOld, sortedParticles + numOld + numNew, CG_CompareParticleSortKeys );
+		std::inplace_merge( sortedParticles, sortedParticles + numOld, sortedParticles + numOld + numNew,
+		                    CG_CompareParticleSortKeys );
 	}
+
+	particleSort.numSorted = numOld + numNew;
+	return particleSort.numSorted;
 }
 
 /*
@@ -2539,13 +3032,8 @@ static void CG_RenderParticle( particle_t *p )
 
 	memset( &re, 0, sizeof( refEntity_t ) );
 
-	timeFrac = CG_CalculateTimeFrac( p->birthTime, p->lifeTime, 0 );
-
-	scale = CG_LerpValues( p->radius.initial,
-	                       p->radius.final,
-	                       CG_CalculateTimeFrac( p->birthTime,
-	                           p->lifeTime,
-	                           p->radius.delay ) );
+	timeFrac = CG_ParticleValue( p, PCH_TIME );
+	scale = CG_ParticleValue( p, PCH_RADIUS );
 
 	re.shaderTime = float(double(p->birthTime) * 0.001);
 
@@ -2569,27 +3057,15 @@ static void CG_RenderParticle( particle_t *p )
 			VectorSubtract( bp->finalColor,
 			                bp->initialColor, colorRange );
 
-			VectorMA( bp->initialColor,
-			          CG_CalculateTimeFrac( p->birthTime,
-			                                p->lifeTime,
-			                                p->colorDelay ),
+			VectorMA( bp->initialColor, CG_ParticleValue( p, PCH_COLOR ),
 			          colorRange, re.shaderRGBA.ToArray() );
 		}
 
-		re.shaderRGBA.SetAlpha( ( float ) 0xFF *
-		                               CG_LerpValues( p->alpha.initial,
-		                                   p->alpha.final,
-		                                   CG_CalculateTimeFrac( p->birthTime,
-		                                       p->lifeTime,
-		                                       p->alpha.delay ) ) );
+		re.shaderRGBA.SetAlpha( ( float ) 0xFF * CG_ParticleValue( p, PCH_ALPHA ) );
 
 		re.radius = scale;
 
-		re.rotation = CG_LerpValues( p->rotation.initial,
-		                             p->rotation.final,
-		                             CG_CalculateTimeFrac( p->birthTime,
-		                                 p->lifeTime,
-		                                 p->rotation.delay ) );
+		re.rotation = CG_ParticleValue( p, PCH_ROTATION );
 
 		// if the view would be "inside" the sprite, kill the sprite
 		// so it doesn't add too much overdraw
@@ -2678,8 +3154,7 @@ static void CG_RenderParticle( particle_t *p )
 	if ( bp->dynamicLight && !( re.renderfx & RF_THIRD_PERSON ) )
 	{
 		trap_R_AddLightToScene( p->origin,
-		                        CG_LerpValues( p->dLightRadius.initial, p->dLightRadius.final,
-		                            CG_CalculateTimeFrac( p->birthTime, p->lifeTime, p->dLightRadius.delay ) ),
+		                        CG_ParticleValue( p, PCH_DLIGHT_RADIUS ),
 		                        3,
 		                        ( float ) bp->dLightColor[ 0 ] / ( float ) 0xFF,
 		                        ( float ) bp->dLightColor[ 1 ] / ( float ) 0xFF,
@@ -2700,9 +3175,12 @@ Add particles to the scene
 */
 void CG_AddParticles()
 {
-	int        i;
+	int        i, numSorted;
 	particle_t *p;
-	int        numPS = 0, numPE = 0, numP = 0;
+	int        numPS = 0, numPE = 0;
+
+	//slots of particles destroyed a while ago can be reused
+	CG_ReclaimParticles();
 
 	//remove expired particle systems
 	CG_GarbageCollectParticleSystems();
@@ -2710,31 +3188,65 @@ void CG_AddParticles()
 	//check each ejector and introduce any new particles
 	CG_SpawnNewParticles();
 
-	//sorting
-	CG_CompactAndSortParticles();
+	//remove particles that died of age or were destroyed last frame
+	for ( i = 0; i < particleStore.numLive; i++ )
+	{
+		p = particleStore.live[ i ];
 
-	for ( i = 0; i < MAX_PARTICLES; i++ )
+		if ( p->valid && p->birthTime + p->lifeTime <= cg.time )
+		{
+			CG_DestroyParticle( p, nullptr );
+		}
+	}
+
+	CG_UnlinkDeadParticles();
+	CG_LerpParticles();
+
+	memset( &particleTraceCounts, 0, sizeof( particleTraceCounts ) );
+	CG_ScheduleParticleTraces();
+
+	for ( i = 0; i < particleStore.numLive; i++ )
 	{
-		p = sortedParticles[ i ];
+		CG_EvaluateParticlePhysics( particleStore.live[ i ] );
+	}
 
-		if ( p->valid )
+	if ( !cg_depthSortParticles.integer )
+	{
+		for ( i = 0; i < particleStore.numLive; i++ )
 		{
-			if ( p->birthTime + p->lifeTime > cg.time )
+			p = particleStore.live[ i ];
+
+			//may have been destroyed by its physics
+			if ( p->valid )
 			{
-				//particle is active
-				CG_EvaluateParticlePhysics( p );
 				CG_RenderParticle( p );
 			}
-			else
+		}
+	}
+	else
+	{
+		//opaque particles in any order, then the blended ones back to front
+		for ( i = 0; i < particleStore.numLive; i++ )
+		{
+			p = particleStore.live[ i ];
+
+			if ( p->valid && !CG_ParticleNeedsBlending( p ) )
 			{
-				CG_DestroyParticle( p, nullptr );
+				CG_RenderParticle( p );
 			}
 		}
+
+		numSorted = CG_SortParticles();
+
+		for ( i = 0; i < numSorted; i++ )
+		{
+			CG_RenderParticle( sortedParticles[ i ] );
+		}
 	}
 
 	if ( cg_debugParticles.integer >= 2 )
 	{
-		for ( i = 0; i < MAX_PARTICLE_SYSTEMS; i++ )
+		for ( i = 0; i < numParticleSystemSlots; i++ )
 		{
 			if ( particleSystems[ i ].valid )
 			{
@@ -2742,7 +3254,7 @@ void CG_AddParticles()
 			}
 		}
 
-		for ( i = 0; i < MAX_PARTICLE_EJECTORS; i++ )
+		for ( i = 0; i < numParticleEjectorSlots; i++ )
 		{
 			if ( particleEjectors[ i ].valid )
 			{
@@ -2750,15 +3262,11 @@ void CG_AddParticles()
 			}
 		}
 
-		for ( i = 0; i < MAX_PARTICLES; i++ )
-		{
-			if ( particles[ i ].valid )
-			{
-				numP++;
-			}
-		}
-
-		Log::Debug( "PS: %d  PE: %d  P: %d", numPS, numPE, numP );
+		Log::Debug( "PS: %d  PE: %d  P: %d", numPS, numPE, particleStore.numLive );
+		Log::Debug( "P traces: %d  deferred: %d  contents: %d  cell hits: %d  cell tests: %d",
+		            particleTraceCounts.traces, particleTraceCounts.deferred,
+		            particleTraceCounts.contents, particleTraceCounts.cellHits,
+		            particleTraceCounts.cellTests );
 	}
 }
 
@@ -35,6 +35,28 @@ static  centity_t *cg_solidEntities[ MAX_ENTITIES_IN_SNAPSHOT ];
 static  int       cg_numTriggerEntities;
 static  centity_t *cg_triggerEntities[ MAX_ENTITIES_IN_SNAPSHOT ];
 
+// broadphase over cg_solidEntities: boxes sorted by their lowest x, bmodels
+// are always clipped against
+#define SOLID_BOUNDS_LEAD 0.1f // seconds of movement the cached bounds cover
+
+typedef struct
+{
+	centity_t *cent;
+	vec3_t    mins, maxs;       // world space, covering where lerpOrigin may go
+	vec3_t    boxMins, boxMaxs; // decoded entityState_t.solid
+} solidBox_t;
+
+static struct
+{
+	solidBox_t boxes[ MAX_ENTITIES_IN_SNAPSHOT ];
+	int        numBoxes;
+	float      maxWidth; // largest x extent of any box
+	centity_t  *bmodels[ MAX_ENTITIES_IN_SNAPSHOT ];
+	int        numBModels;
+	int        frame;
+	bool       valid;
+} solidBroadphase;
+
 /*
 ====================
 CG_BuildSolidList
@@ -54,6 +76,7 @@ void CG_BuildSolidList()
 
 	cg_numSolidEntities = 0;
 	cg_numTriggerEntities = 0;
+	solidBroadphase.valid = false;
 
 	if ( cg.nextSnap && !cg.nextFrameTeleport && !cg.thisFrameTeleport )
 	{
@@ -101,140 +124,261 @@ void CG_BuildSolidList()
 
 /*
 ====================
-CG_ClipMoveToEntities
-
+CG_BuildSolidBroadphase
+
+Decodes the box of every solid entity once and sorts the boxes along x.
+Traces made before the entities are lerped see lerpOrigin change under them,
+so the world space bounds cover both snapshot positions plus how far each
+entity can get in SOLID_BOUNDS_LEAD, and the exact test in
+CG_ClipMoveToEntity uses the current lerpOrigin. Rebuilt when the solid list
+changes, once per frame and once the entities have been lerped.
 ====================
 */
-static void CG_ClipMoveToEntities( const vec3_t start, const vec3_t mins,
-                                   const vec3_t maxs, const vec3_t end, int skipNumber,
-                                   int mask, int skipmask, trace_t *tr, traceType_t collisionType )
+static void CG_BuildSolidBroadphase()
 {
-	int           i, x, zd, zu;
-	trace_t       trace;
-	entityState_t *ent;
-	clipHandle_t  cmodel;
-	vec3_t        tmins, tmaxs;
-	vec3_t        bmins, bmaxs;
-	vec3_t        origin, angles;
-	centity_t     *cent;
+	solidBroadphase.numBoxes = 0;
+	solidBroadphase.numBModels = 0;
+	solidBroadphase.maxWidth = 0.0f;
 
-	// calculate bounding box of the trace
-	ClearBounds( tmins, tmaxs );
-	AddPointToBounds( start, tmins, tmaxs );
-	AddPointToBounds( end, tmins, tmaxs );
-	if( mins )
-		VectorAdd( mins, tmins, tmins );
-	if( maxs )
-		VectorAdd( maxs, tmaxs, tmaxs );
-
-	for ( i = 0; i < cg_numSolidEntities; i++ )
+	for ( int i = 0; i < cg_numSolidEntities; i++ )
 	{
-		if ( i < cg_numSolidEntities )
-		{
-			cent = cg_solidEntities[ i ];
-		}
-		else
-		{
-			cent = &cg.predictedPlayerEntity;
-		}
-
-		ent = &cent->currentState;
+		centity_t     *cent = cg_solidEntities[ i ];
+		entityState_t *ent = &cent->currentState;
 
-		if ( ent->number == skipNumber )
+		if ( ent->solid == SOLID_BMODEL )
 		{
+			solidBroadphase.bmodels[ solidBroadphase.numBModels++ ] = cent;
 			continue;
 		}
 
-		if ( !( cent->contents & mask ) )
+		solidBox_t *box = &solidBroadphase.boxes[ solidBroadphase.numBoxes++ ];
+
+		// encoded bbox
+		int x = ( ent->solid & 255 );
+		int zd = ( ( ent->solid >> 8 ) & 255 );
+		int zu = ( ( ent->solid >> 16 ) & 255 ) - 32;
+
+		box->cent = cent;
+		box->boxMins[ 0 ] = box->boxMins[ 1 ] = -x;
+		box->boxMaxs[ 0 ] = box->boxMaxs[ 1 ] = x;
+		box->boxMins[ 2 ] = -zd;
+		box->boxMaxs[ 2 ] = zu;
+
+		// lerpOrigin is recalculated later in the frame, it may move along the
+		// trajectory or anywhere between the two snapshot positions
+		float lead = VectorLength( ent->pos.trDelta ) * SOLID_BOUNDS_LEAD;
+
+		ClearBounds( box->mins, box->maxs );
+		AddPointToBounds( cent->lerpOrigin, box->mins, box->maxs );
+		AddPointToBounds( cent->currentState.pos.trBase, box->mins, box->maxs );
+
+		if ( cent->interpolate )
 		{
-			continue;
+			AddPointToBounds( cent->nextState.pos.trBase, box->mins, box->maxs );
 		}
 
-		if ( cent->contents & skipmask )
+		for ( int j = 0; j < 3; j++ )
 		{
-			continue;
+			box->mins[ j ] += box->boxMins[ j ] - lead;
+			box->maxs[ j ] += box->boxMaxs[ j ] + lead;
 		}
 
-		if ( ent->solid == SOLID_BMODEL )
+		solidBroadphase.maxWidth = std::max( solidBroadphase.maxWidth, box->maxs[ 0 ] - box->mins[ 0 ] );
+	}
+
+	std::sort( solidBroadphase.boxes, solidBroadphase.boxes + solidBroadphase.numBoxes,
+	           []( const solidBox_t &a, const solidBox_t &b ) { return a.mins[ 0 ] < b.mins[ 0 ]; } );
+
+	solidBroadphase.frame = cg.clientFrame;
+	solidBroadphase.valid = true;
+}
+
+typedef struct
+{
+	const float *start, *end;
+	const float *mins, *maxs; // size of the moving object, may be nullptr
+	vec3_t      tmins, tmaxs; // enclose the moving object along the entire move
+	int         skipNumber;
+	int         mask;
+	int         skipmask;
+	traceType_t collisionType;
+	trace_t     *tr;
+} moveclip_t;
+
+/*
+====================
+CG_InvalidateSolidBroadphase
+
+Called once the entities have been lerped, so the rest of the frame clips
+against bounds built from their final positions.
+====================
+*/
+void CG_InvalidateSolidBroadphase()
+{
+	solidBroadphase.valid = false;
+}
+
+/*
+====================
+CG_ClipMoveToEntity
+
+Clips the move against a single entity and merges the result.
+Returns true once the move is allsolid and no further clipping is needed.
+====================
+*/
+static bool CG_ClipMoveToEntity( moveclip_t *clip, centity_t *cent, const solidBox_t *box )
+{
+	trace_t       trace;
+	entityState_t *ent = &cent->currentState;
+	trace_t       *tr = clip->tr;
+	clipHandle_t  cmodel;
+	vec3_t        bmins, bmaxs;
+	vec3_t        origin, angles;
+
+	if ( ent->number == clip->skipNumber )
+	{
+		return false;
+	}
+
+	if ( !( cent->contents & clip->mask ) )
+	{
+		return false;
+	}
+
+	if ( cent->contents & clip->skipmask )
+	{
+		return false;
+	}
+
+	if ( !box )
+	{
+		// special value for bmodel
+		cmodel = trap_CM_InlineModel( ent->modelindex );
+		VectorCopy( cent->lerpAngles, angles );
+		BG_EvaluateTrajectory( &cent->currentState.pos, cg.physicsTime, origin );
+	}
+	else
+	{
+		VectorAdd( cent->lerpOrigin, box->boxMins, bmins );
+		VectorAdd( cent->lerpOrigin, box->boxMaxs, bmaxs );
+
+		if( !BoundsIntersect( bmins, bmaxs, clip->tmins, clip->tmaxs ) )
+			return false;
+
+		// the engine has a single temporary box model, so the handle can't be kept
+		cmodel = trap_CM_TempBoxModel( bmins, bmaxs );
+		VectorCopy( vec3_origin, angles );
+		VectorCopy( vec3_origin, origin );
+	}
+
+	switch ( clip->collisionType )
+	{
+	case traceType_t::TT_CAPSULE:
+		trap_CM_TransformedCapsuleTrace( &trace, clip->start, clip->end, clip->mins, clip->maxs, cmodel,
+		                                 clip->mask, clip->skipmask, origin, angles );
+		break;
+
+	case traceType_t::TT_AABB:
+		trap_CM_TransformedBoxTrace( &trace, clip->start, clip->end, clip->mins, clip->maxs, cmodel,
+		                             clip->mask, clip->skipmask, origin, angles );
+		break;
+
+	case traceType_t::TT_BISPHERE:
+		ASSERT(clip->maxs != nullptr);
+		ASSERT(clip->mins != nullptr);
+		trap_CM_TransformedBiSphereTrace( &trace, clip->start, clip->end, clip->mins[ 0 ], clip->maxs[ 0 ],
+		                                  cmodel, clip->mask, clip->skipmask, origin );
+		break;
+
+	default: // Shouldn't Happen
+		ASSERT(0);
+	}
+
+	if ( trace.allsolid || trace.fraction < tr->fraction )
+	{
+		trace.entityNum = ent->number;
+
+		if ( tr->lateralFraction < trace.lateralFraction )
 		{
-			// special value for bmodel
-			cmodel = trap_CM_InlineModel( ent->modelindex );
-			VectorCopy( cent->lerpAngles, angles );
-			BG_EvaluateTrajectory( &cent->currentState.pos, cg.physicsTime, origin );
+			float oldLateralFraction = tr->lateralFraction;
+			*tr = trace;
+			tr->lateralFraction = oldLateralFraction;
 		}
 		else
 		{
-			// encoded bbox
-			x = ( ent->solid & 255 );
-			zd = ( ( ent->solid >> 8 ) & 255 );
-			zu = ( ( ent->solid >> 16 ) & 255 ) - 32;
-
-			bmins[ 0 ] = bmins[ 1 ] = -x;
-			bmaxs[ 0 ] = bmaxs[ 1 ] = x;
-			bmins[ 2 ] = -zd;
-			bmaxs[ 2 ] = zu;
-
-			if ( i == cg_numSolidEntities )
-			{
-				BG_ClassBoundingBox( ( ent->misc >> 8 ) & 0xFF, bmins, bmaxs, nullptr, nullptr, nullptr );
-			}
+			*tr = trace;
+		}
+	}
+	else if ( trace.startsolid )
+	{
+		tr->startsolid = true;
+		tr->entityNum = ent->number;
+	}
 
-			VectorAdd( cent->lerpOrigin, bmins, bmins );
-			VectorAdd( cent->lerpOrigin, bmaxs, bmaxs );
+	return tr->allsolid;
+}
 
-			if( !BoundsIntersect( bmins, bmaxs, tmins, tmaxs ) )
-				continue;
+/*
+====================
+CG_ClipMoveToEntities
 
-			cmodel = trap_CM_TempBoxModel( bmins, bmaxs );
-			VectorCopy( vec3_origin, angles );
-			VectorCopy( vec3_origin, origin );
-		}
+Only boxes whose cached bounds overlap the swept bounds of the move are
+clipped against.
+====================
+*/
+static void CG_ClipMoveToEntities( const vec3_t start, const vec3_t mins,
+                                   const vec3_t maxs, const vec3_t end, int skipNumber,
+                                   int mask, int skipmask, trace_t *tr, traceType_t collisionType )
+{
+	moveclip_t clip;
+	int        i;
 
-		switch ( collisionType )
-		{
-		case traceType_t::TT_CAPSULE:
-			trap_CM_TransformedCapsuleTrace( &trace, start, end, mins, maxs, cmodel, mask, skipmask,
-			                                 origin, angles );
-			break;
+	if ( !solidBroadphase.valid || solidBroadphase.frame != cg.clientFrame )
+	{
+		CG_BuildSolidBroadphase();
+	}
 
-		case traceType_t::TT_AABB:
-			trap_CM_TransformedBoxTrace( &trace, start, end, mins, maxs, cmodel, mask, skipmask,
-			                             origin, angles );
-			break;
+	clip.start = start;
+	clip.end = end;
+	clip.mins = mins;
+	clip.maxs = maxs;
+	clip.skipNumber = skipNumber;
+	clip.mask = mask;
+	clip.skipmask = skipmask;
+	clip.collisionType = collisionType;
+	clip.tr = tr;
 
-        case traceType_t::TT_BISPHERE:
-			ASSERT(maxs != nullptr);
-			ASSERT(mins != nullptr);
-			trap_CM_TransformedBiSphereTrace( &trace, start, end, mins[ 0 ], maxs[ 0 ], cmodel,
-			                                  mask, skipmask, origin );
-			break;
+	// calculate bounding box of the trace
+	ClearBounds( clip.tmins, clip.tmaxs );
+	AddPointToBounds( start, clip.tmins, clip.tmaxs );
+	AddPointToBounds( end, clip.tmins, clip.tmaxs );
+	if( mins )
+		VectorAdd( mins, clip.tmins, clip.tmins );
+	if( maxs )
+		VectorAdd( maxs, clip.tmaxs, clip.tmaxs );
 
-		default: // Shouldn't Happen
-			ASSERT(0);
+	for ( i = 0; i < solidBroadphase.numBModels; i++ )
+	{
+		if ( CG_ClipMoveToEntity( &clip, solidBroadphase.bmodels[ i ], nullptr ) )
+		{
+			return;
 		}
+	}
 
-		if ( trace.allsolid || trace.fraction < tr->fraction )
-		{
-			trace.entityNum = ent->number;
+	// no box starting further left than this can reach the move
+	float      left = clip.tmins[ 0 ] - solidBroadphase.maxWidth;
+	solidBox_t *box = std::lower_bound( solidBroadphase.boxes, solidBroadphase.boxes + solidBroadphase.numBoxes, left,
+	                                    []( const solidBox_t &b, float x ) { return b.mins[ 0 ] < x; } );
+	solidBox_t *last = solidBroadphase.boxes + solidBroadphase.numBoxes;
 
-			if ( tr->lateralFraction < trace.lateralFraction )
-			{
-				float oldLateralFraction = tr->lateralFraction;
-				*tr = trace;
-				tr->lateralFraction = oldLateralFraction;
-			}
-			else
-			{
-				*tr = trace;
-			}
-		}
-		else if ( trace.startsolid )
+	for ( ; box < last && box->mins[ 0 ] <= clip.tmaxs[ 0 ]; box++ )
+	{
+		if ( !BoundsIntersect( box->mins, box->maxs, clip.tmins, clip.tmaxs ) )
 		{
-			tr->startsolid = true;
-			tr->entityNum = ent->number;
+			continue;
 		}
 
-		if ( tr->allsolid )
+		if ( CG_ClipMoveToEntity( &clip, box->cent, box ) )
 		{
 			return;
 		}
@@ -75,6 +75,7 @@ void CG_RegisterRocketCvars()
 }
 
 static connstate_t oldConnState;
+static int         oldDisabledGameElements;
 
 void CG_Rocket_Init( glconfig_t gl )
 {
@@ -626,6 +627,21 @@ void CG_Rocket_Frame( cgClientState_t state )
 		CG_Rocket_BuildServerInfo();
 	}
 
+	// The menus listing game elements are only rebuilt when they are opened,
+	// so refresh them if the disabled elements change while they are open.
+	if ( oldDisabledGameElements != BG_DisabledGameElementsGeneration() )
+	{
+		if ( oldDisabledGameElements && rocketInfo.cstate.connState == connstate_t::CA_ACTIVE )
+		{
+			CG_Rocket_BuildDataSource( "armouryBuyList", "default" );
+			CG_Rocket_BuildDataSource( "alienEvolveList", "default" );
+			CG_Rocket_BuildDataSource( "humanBuildList", "default" );
+			CG_Rocket_BuildDataSource( "alienBuildList", "default" );
+		}
+
+		oldDisabledGameElements = BG_DisabledGameElementsGeneration();
+	}
+
 	if ( cg.scoreInvalidated )
 	{
 		CG_Rocket_BuildPlayerList( nullptr );
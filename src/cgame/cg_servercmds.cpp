@@ -38,15 +38,16 @@ static void CG_ParseScores()
 {
 	int i;
 
-	cg.numScores = ( trap_Argc() - 3 ) / 6;
+	cg.numScores = ( trap_Argc() - 4 ) / 6;
 
 	if ( cg.numScores > MAX_CLIENTS )
 	{
 		cg.numScores = MAX_CLIENTS;
 	}
 
-	cg.teamScores[ 0 ] = atoi( CG_Argv( 1 ) );
-	cg.teamScores[ 1 ] = atoi( CG_Argv( 2 ) );
+	cg.scoresSeq = atoi( CG_Argv( 1 ) );
+	cg.teamScores[ 0 ] = atoi( CG_Argv( 2 ) );
+	cg.teamScores[ 1 ] = atoi( CG_Argv( 3 ) );
 
 	memset( cg.scores, 0, sizeof( cg.scores ) );
 
@@ -58,12 +59,12 @@ static void CG_ParseScores()
 	for ( i = 0; i < cg.numScores; i++ )
 	{
 		//
-		cg.scores[ i ].client = atoi( CG_Argv( i * 6 + 3 ) );
-		cg.scores[ i ].score = atoi( CG_Argv( i * 6 + 4 ) );
-		cg.scores[ i ].ping = atoi( CG_Argv( i * 6 + 5 ) );
-		cg.scores[ i ].time = atoi( CG_Argv( i * 6 + 6 ) );
-		cg.scores[ i ].weapon = (weapon_t) atoi( CG_Argv( i * 6 + 7 ) );
-		cg.scores[ i ].upgrade = (upgrade_t) atoi( CG_Argv( i * 6 + 8 ) );
+		cg.scores[ i ].client = atoi( CG_Argv( i * 6 + 4 ) );
+		cg.scores[ i ].score = atoi( CG_Argv( i * 6 + 5 ) );
+		cg.scores[ i ].ping = atoi( CG_Argv( i * 6 + 6 ) );
+		cg.scores[ i ].time = atoi( CG_Argv( i * 6 + 7 ) );
+		cg.scores[ i ].weapon = (weapon_t) atoi( CG_Argv( i * 6 + 8 ) );
+		cg.scores[ i ].upgrade = (upgrade_t) atoi( CG_Argv( i * 6 + 9 ) );
 
 		if ( cg.scores[ i ].client < 0 || cg.scores[ i ].client >= MAX_CLIENTS )
 		{
@@ -78,21 +79,130 @@ static void CG_ParseScores()
 	cg.scoreInvalidated = true;
 }
 
+/*
+=================
+CG_ParseScoresDelta
+
+Applies the changes since the scoreboard we hold.  The optional rank order
+is followed by the changed rows, keyed by client number.
+=================
+*/
+static void CG_ParseScoresDelta()
+{
+	int     i, arg, argc;
+	int     numScores;
+	int     client;
+	score_t *score;
+	score_t previous[ MAX_CLIENTS ];
+	bool    ranked[ MAX_CLIENTS ];
+
+	// we don't hold the scoreboard these changes apply to, get a whole one
+	if ( atoi( CG_Argv( 2 ) ) != cg.scoresSeq )
+	{
+		CG_RequestScores();
+		return;
+	}
+
+	argc = trap_Argc();
+	cg.scoresSeq = atoi( CG_Argv( 1 ) );
+	cg.teamScores[ 0 ] = atoi( CG_Argv( 3 ) );
+	cg.teamScores[ 1 ] = atoi( CG_Argv( 4 ) );
+
+	numScores = atoi( CG_Argv( 5 ) );
+	arg = 6;
+
+	if ( numScores >= 0 )
+	{
+		// new rank order, carry the rows over
+		memset( previous, 0, sizeof( previous ) );
+		memset( ranked, 0, sizeof( ranked ) );
+
+		for ( i = 0; i < cg.numScores; i++ )
+		{
+			previous[ cg.scores[ i ].client ] = cg.scores[ i ];
+			ranked[ cg.scores[ i ].client ] = true;
+		}
+
+		cg.numScores = std::min( numScores, MAX_CLIENTS );
+
+		for ( i = 0; i < cg.numScores; i++ )
+		{
+			client = atoi( CG_Argv( arg++ ) );
+
+			if ( client < 0 || client >= MAX_CLIENTS )
+			{
+				client = 0;
+			}
+
+			if ( ranked[ client ] )
+			{
+				cg.scores[ i ] = previous[ client ];
+			}
+			else
+			{
+				memset( &cg.scores[ i ], 0, sizeof( score_t ) );
+				cg.scores[ i ].client = client;
+			}
+		}
+	}
+
+	for ( ; arg + 6 <= argc; arg += 6 )
+	{
+		client = atoi( CG_Argv( arg ) );
+		score = nullptr;
+
+		for ( i = 0; i < cg.numScores; i++ )
+		{
+			if ( cg.scores[ i ].client == client )
+			{
+				score = &cg.scores[ i ];
+				break;
+			}
+		}
+
+		if ( !score )
+		{
+			Log::Warn( S_SKIPNOTIFY "CG_ParseScoresDelta: unranked client: %d", client );
+			continue;
+		}
+
+		score->score = atoi( CG_Argv( arg + 1 ) );
+		score->ping = atoi( CG_Argv( arg + 2 ) );
+		score->time = atoi( CG_Argv( arg + 3 ) );
+		score->weapon = (weapon_t) atoi( CG_Argv( arg + 4 ) );
+		score->upgrade = (upgrade_t) atoi( CG_Argv( arg + 5 ) );
+
+		cgs.clientinfo[ client ].score = score->score;
+	}
+
+	// teams can change without the row changing
+	for ( i = 0; i < cg.numScores; i++ )
+	{
+		cg.scores[ i ].team = cgs.clientinfo[ cg.scores[ i ].client ].team;
+	}
+
+	cg.scoreInvalidated = true;
+}
+
 /*
 =================
 CG_ParseTeamInfo
 
+Each entry is a client number and a mask of the TEAMINFO_* fields that follow
+it, only changed fields are sent.
 =================
 */
 static void CG_ParseTeamInfo()
 {
-	int i;
-	int count;
-	int client;
+	int          i;
+	int          count;
+	int          client;
+	int          fields;
+	clientInfo_t *ci;
 
 	count = trap_Argc();
 
-	for ( i = 1; i < count; ++i ) // i is also incremented when writing into cgs.clientinfo
+	for ( i = 1; i + 1 < count; ++i ) // i is also incremented when writing into cgs.clientinfo
 	{
 		client = atoi( CG_Argv( i ) );
 
@@ -108,14 +218,32 @@ static void CG_ParseTeamInfo()
 			return;
 		}
 
-		cgs.clientinfo[ client ].location       = atoi( CG_Argv( ++i ) );
-		cgs.clientinfo[ client ].health         = atoi( CG_Argv( ++i ) );
-		cgs.clientinfo[ client ].curWeaponClass = atoi( CG_Argv( ++i ) );
-		cgs.clientinfo[ client ].credit         = atoi( CG_Argv( ++i ) );
+		ci = &cgs.clientinfo[ client ];
+		fields = atoi( CG_Argv( ++i ) );
+
+		if ( fields & TEAMINFO_LOCATION )
+		{
+			ci->location = atoi( CG_Argv( ++i ) );
+		}
+
+		if ( fields & TEAMINFO_HEALTH )
+		{
+			ci->health = atoi( CG_Argv( ++i ) );
+		}
 
-		if( cg.snap->ps.persistant[ PERS_TEAM ] != TEAM_ALIENS )
+		if ( fields & TEAMINFO_WEAPON )
 		{
-			cgs.clientinfo[ client ].upgrade = atoi( CG_Argv( ++i ) );
+			ci->curWeaponClass = atoi( CG_Argv( ++i ) );
+		}
+
+		if ( fields & TEAMINFO_CREDIT )
+		{
+			ci->credit = atoi( CG_Argv( ++i ) );
+		}
+
+		if ( fields & TEAMINFO_UPGRADE )
+		{
+			ci->upgrade = atoi( CG_Argv( ++i ) );
 		}
 	}
 
@@ -267,6 +395,11 @@ static void CG_ConfigStringModified()
 	{
 		CG_StartMusic();
 	}
+	else if ( num == CS_SYSTEMINFO )
+	{
+		// the engine has already applied the systeminfo cvars
+		BG_InitAllowedGameElements();
+	}
 	else if ( num == CS_SERVERINFO )
 	{
 		CG_ParseServerinfo();
@@ -1345,6 +1478,7 @@ static const consoleCommand_t svcommands[] =
 	{ "print_tr",         CG_PrintTR_f            },
 	{ "print_tr_p",       CG_PrintTR_plural_f     },
 	{ "scores",           CG_ParseScores          },
+	{ "scoresd",          CG_ParseScoresDelta     },
 	{ "serverclosemenus", CG_ServerCloseMenus_f   },
 	{ "servermenu",       CG_ServerMenu_f         },
 	{ "tinfo",            CG_ParseTeamInfo        },
@@ -32,6 +32,9 @@ static int               numBaseTrailBeams = 0;
 static trailSystem_t     trailSystems[ MAX_TRAIL_SYSTEMS ];
 static trailBeam_t       trailBeams[ MAX_TRAIL_BEAMS ];
 
+static trailBeamNode_t   trailBeamNodes[ MAX_TRAIL_NODES ];
+static trailBeamNode_t   *freeTrailBeamNodes;
+
 /*
 ===============
 CG_CalculateBeamNodeProperties
@@ -142,11 +145,24 @@ static void CG_LightVertex( vec3_t point, byte alpha, byte *rgba )
 	rgba[ 3 ] = alpha;
 }
 
+/*
+===============
+CG_BeamVertex
+===============
+*/
+static void CG_BeamVertex( polyVert_t *vert, const vec3_t xyz, float s, float t, const byte *modulate )
+{
+	VectorCopy( xyz, vert->xyz );
+	vert->st[ 0 ] = s;
+	vert->st[ 1 ] = t;
+	Vector4Copy( modulate, vert->modulate );
+}
+
 /*
 ===============
 CG_RenderBeam
 
-Renders a beam
+Renders a beam, all of its quads go to the renderer in one call
 ===============
 */
 static void CG_RenderBeam( trailBeam_t *tb )
@@ -154,14 +170,15 @@ static void CG_RenderBeam( trailBeam_t *tb )
 	trailBeamNode_t   *i = nullptr;
 	trailBeamNode_t   *prev = nullptr;
 	trailBeamNode_t   *next = nullptr;
-	vec3_t            up;
+	vec3_t            up, top, bottom;
+	byte              modulate[ 4 ];
 	polyVert_t        verts[( MAX_TRAIL_BEAM_NODES - 1 ) * 4 ];
 	int               numVerts = 0;
 	baseTrailBeam_t   *btb;
 	trailSystem_t     *ts;
 	baseTrailSystem_t *bts;
 
-	if ( !tb || !tb->nodes )
+	if ( !tb || !tb->nodes || !tb->nodes->next )
 	{
 		return;
 	}
@@ -180,9 +197,7 @@ static void CG_RenderBeam( trailBeam_t *tb )
 
 	CG_CalculateBeamNodeProperties( tb );
 
-	i = tb->nodes;
-
-	do
+	for ( i = tb->nodes; i; i = i->next )
 	{
 		prev = i->prev;
 		next = i->next;
@@ -192,89 +207,43 @@ static void CG_RenderBeam( trailBeam_t *tb )
 			//this node has two neighbours
 			GetPerpendicularViewVector( cg.refdef.vieworg, next->position, prev->position, up );
 		}
-		else if ( !prev && next )
+		else if ( next )
 		{
 			//this is the front
 			GetPerpendicularViewVector( cg.refdef.vieworg, next->position, i->position, up );
 		}
-		else if ( prev && !next )
+		else
 		{
 			//this is the back
 			GetPerpendicularViewVector( cg.refdef.vieworg, i->position, prev->position, up );
 		}
+
+		//both sides of the beam share the lighting of the node
+		if ( btb->realLight )
+		{
+			CG_LightVertex( i->position, i->alpha, modulate );
+		}
 		else
 		{
-			break;
+			VectorCopy( i->color, modulate );
+			modulate[ 3 ] = i->alpha;
 		}
 
+		VectorMA( i->position, i->halfWidth, up, top );
+		VectorMA( i->position, -i->halfWidth, up, bottom );
+
+		//close the quad from the previous node
 		if ( prev )
 		{
-			VectorMA( i->position, i->halfWidth, up, verts[ numVerts ].xyz );
-			verts[ numVerts ].st[ 0 ] = i->textureCoord;
-			verts[ numVerts ].st[ 1 ] = 1.0f;
-
-			if ( btb->realLight )
-			{
-				CG_LightVertex( verts[ numVerts ].xyz, i->alpha, verts[ numVerts ].modulate );
-			}
-			else
-			{
-				VectorCopy( i->color, verts[ numVerts ].modulate );
-				verts[ numVerts ].modulate[ 3 ] = i->alpha;
-			}
-
-			numVerts++;
-
-			VectorMA( i->position, -i->halfWidth, up, verts[ numVerts ].xyz );
-			verts[ numVerts ].st[ 0 ] = i->textureCoord;
-			verts[ numVerts ].st[ 1 ] = 0.0f;
-
-			if ( btb->realLight )
-			{
-				CG_LightVertex( verts[ numVerts ].xyz, i->alpha, verts[ numVerts ].modulate );
-			}
-			else
-			{
-				VectorCopy( i->color, verts[ numVerts ].modulate );
-				verts[ numVerts ].modulate[ 3 ] = i->alpha;
-			}
-
-			numVerts++;
+			CG_BeamVertex( &verts[ numVerts++ ], top, i->textureCoord, 1.0f, modulate );
+			CG_BeamVertex( &verts[ numVerts++ ], bottom, i->textureCoord, 0.0f, modulate );
 		}
 
+		//open the quad to the next node
 		if ( next )
 		{
-			VectorMA( i->position, -i->halfWidth, up, verts[ numVerts ].xyz );
-			verts[ numVerts ].st[ 0 ] = i->textureCoord;
-			verts[ numVerts ].st[ 1 ] = 0.0f;
-
-			if ( btb->realLight )
-			{
-				CG_LightVertex( verts[ numVerts ].xyz, i->alpha, verts[ numVerts ].modulate );
-			}
-			else
-			{
-				VectorCopy( i->color, verts[ numVerts ].modulate );
-				verts[ numVerts ].modulate[ 3 ] = i->alpha;
-			}
-
-			numVerts++;
-
-			VectorMA( i->position, i->halfWidth, up, verts[ numVerts ].xyz );
-			verts[ numVerts ].st[ 0 ] = i->textureCoord;
-			verts[ numVerts ].st[ 1 ] = 1.0f;
-
-			if ( btb->realLight )
-			{
-				CG_LightVertex( verts[ numVerts ].xyz, i->alpha, verts[ numVerts ].modulate );
-			}
-			else
-			{
-				VectorCopy( i->color, verts[ numVerts ].modulate );
-				verts[ numVerts ].modulate[ 3 ] = i->alpha;
-			}
-
-			numVerts++;
+			CG_BeamVertex( &verts[ numVerts++ ], bottom, i->textureCoord, 0.0f, modulate );
+			CG_BeamVertex( &verts[ numVerts++ ], top, i->textureCoord, 1.0f, modulate );
 		}
 
 		if( btb->dynamicLight ) {
@@ -285,130 +254,130 @@ static void CG_RenderBeam( trailBeam_t *tb )
 						( float ) btb->dLightColor[ 1 ] / ( float ) 0xFF,
 						( float ) btb->dLightColor[ 2 ] / ( float ) 0xFF, 0, 0 );
 		}
-
-		i = i->next;
 	}
-	while ( i );
 
 	trap_R_AddPolysToScene( tb->class_->shader, 4, &verts[ 0 ], numVerts / 4 );
 }
 
 /*
 ===============
-CG_AllocateBeamNode
+CG_ResetTrailBeamNodes
 
-Allocates a trailBeamNode_t from a trailBeam_t's nodePool
+Put all nodes of the shared pool back on the free list
 ===============
 */
-static trailBeamNode_t *CG_AllocateBeamNode( trailBeam_t *tb )
+static void CG_ResetTrailBeamNodes()
 {
-	baseTrailBeam_t *btb = tb->class_;
-	int             i;
-	trailBeamNode_t *tbn;
+	int i;
 
-	for ( i = 0; i < MAX_TRAIL_BEAM_NODES; i++ )
-	{
-		tbn = &tb->nodePool[ i ];
+	memset( trailSystems, 0, sizeof( trailSystems ) );
+	memset( trailBeams, 0, sizeof( trailBeams ) );
 
-		if ( !tbn->used )
-		{
-			tbn->timeLeft = btb->segmentTime;
-			tbn->prev = nullptr;
-			tbn->next = nullptr;
-			tbn->used = true;
-			return tbn;
-		}
+	for ( i = 0; i < MAX_TRAIL_NODES - 1; i++ )
+	{
+		trailBeamNodes[ i ].next = &trailBeamNodes[ i + 1 ];
 	}
 
-	// no space left
-	return nullptr;
+	trailBeamNodes[ MAX_TRAIL_NODES - 1 ].next = nullptr;
+	freeTrailBeamNodes = &trailBeamNodes[ 0 ];
 }
 
 /*
 ===============
-CG_DestroyBeamNode
+CG_AllocateBeamNode
 
-Removes a node from a beam
-Returns the new head
+Allocates a trailBeamNode_t from the shared pool
 ===============
 */
-static trailBeamNode_t *CG_DestroyBeamNode( trailBeamNode_t *tbn )
+static trailBeamNode_t *CG_AllocateBeamNode( trailBeam_t *tb )
 {
-	trailBeamNode_t *newHead = nullptr;
+	baseTrailBeam_t *btb = tb->class_;
+	trailBeamNode_t *tbn = freeTrailBeamNodes;
+	int             j;
 
-	if ( tbn->prev )
+	// no space left
+	if ( !tbn || tb->numNodes >= MAX_TRAIL_BEAM_NODES )
 	{
-		if ( tbn->next )
+		if ( cg_debugTrails.integer >= 1 )
 		{
-			// node is in the middle
-			tbn->prev->next = tbn->next;
-			tbn->next->prev = tbn->prev;
+			Log::Debug( "MAX_TRAIL_NODES" );
 		}
-		else // node is at the back
-		{
-			tbn->prev->next = nullptr;
-		}
-
-		// find the new head (shouldn't have changed)
-		newHead = tbn->prev;
 
-		while ( newHead->prev )
-		{
-			newHead = newHead->prev;
-		}
-	}
-	else if ( tbn->next )
-	{
-		//node is at the front
-		tbn->next->prev = nullptr;
-		newHead = tbn->next;
+		return nullptr;
 	}
 
+	freeTrailBeamNodes = tbn->next;
+
+	tbn->timeLeft = btb->segmentTime;
 	tbn->prev = nullptr;
 	tbn->next = nullptr;
-	tbn->used = false;
 
-	return newHead;
+	for ( j = 0; j < btb->numJitters; j++ )
+	{
+		tbn->jitters[ j ][ 0 ] = ( crandom() * btb->jitters[ j ].magnitude );
+		tbn->jitters[ j ][ 1 ] = ( crandom() * btb->jitters[ j ].magnitude );
+	}
+
+	tbn->jitterAmount[ 0 ] = tbn->jitterAmount[ 1 ] = 0.0f;
+	VectorClear( tbn->jitterOffset );
+
+	tb->numNodes++;
+	tb->jitterDirty = true;
+
+	return tbn;
 }
 
 /*
 ===============
-CG_FindLastBeamNode
+CG_DestroyBeamNode
 
-Returns the last beam node in a beam
+Removes a node from a beam and returns it to the pool
 ===============
 */
-static trailBeamNode_t *CG_FindLastBeamNode( trailBeam_t *tb )
+static void CG_DestroyBeamNode( trailBeam_t *tb, trailBeamNode_t *tbn )
 {
-	trailBeamNode_t *i = tb->nodes;
+	if ( tbn->prev )
+	{
+		tbn->prev->next = tbn->next;
+	}
+	else
+	{
+		tb->nodes = tbn->next;
+	}
 
-	while ( i && i->next )
+	if ( tbn->next )
 	{
-		i = i->next;
+		tbn->next->prev = tbn->prev;
+	}
+	else
+	{
+		tb->lastNode = tbn->prev;
 	}
 
-	return i;
+	tb->numNodes--;
+
+	tbn->prev = nullptr;
+	tbn->next = freeTrailBeamNodes;
+	freeTrailBeamNodes = tbn;
 }
 
 /*
 ===============
-CG_CountBeamNodes
+CG_DestroyBeamNodes
 
-Returns the number of nodes in a beam
+Returns all nodes of a beam to the pool
 ===============
 */
-static int CG_CountBeamNodes( trailBeam_t *tb )
+static void CG_DestroyBeamNodes( trailBeam_t *tb )
 {
-	trailBeamNode_t *i = tb->nodes;
-	int             numNodes = 0;
-
-	while ( i )
+	if ( tb->nodes )
 	{
-		numNodes++;
-		i = i->next;
+		tb->lastNode->next = freeTrailBeamNodes;
+		freeTrailBeamNodes = tb->nodes;
 	}
 
-	return numNodes;
+	tb->nodes = tb->lastNode = nullptr;
+	tb->numNodes = 0;
 }
 
 /*
@@ -421,30 +390,26 @@ Returns the new node
 */
 static trailBeamNode_t *CG_PrependBeamNode( trailBeam_t *tb )
 {
-	trailBeamNode_t *i;
+	trailBeamNode_t *i = CG_AllocateBeamNode( tb );
+
+	if ( !i )
+	{
+		return nullptr;
+	}
 
 	if ( tb->nodes )
 	{
 		// prepend another node
-		i = CG_AllocateBeamNode( tb );
-
-		if ( i )
-		{
-			i->next = tb->nodes;
-			tb->nodes->prev = i;
-			tb->nodes = i;
-		}
+		i->next = tb->nodes;
+		tb->nodes->prev = i;
 	}
 	else //add first node
 	{
-		i = CG_AllocateBeamNode( tb );
-
-		if ( i )
-		{
-			tb->nodes = i;
-		}
+		tb->lastNode = i;
 	}
 
+	tb->nodes = i;
+
 	return i;
 }
 
@@ -458,37 +423,104 @@ Returns the new node
 */
 static trailBeamNode_t *CG_AppendBeamNode( trailBeam_t *tb )
 {
-	trailBeamNode_t *last, *i;
+	trailBeamNode_t *i = CG_AllocateBeamNode( tb );
+
+	if ( !i )
+	{
+		return nullptr;
+	}
 
 	if ( tb->nodes )
 	{
 		// append another node
-		last = CG_FindLastBeamNode( tb );
-		i = CG_AllocateBeamNode( tb );
-
-		if ( i )
-		{
-			last->next = i;
-			i->prev = last;
-			i->next = nullptr;
-		}
+		tb->lastNode->next = i;
+		i->prev = tb->lastNode;
 	}
 	else //add first node
 	{
-		i = CG_AllocateBeamNode( tb );
-
-		if ( i )
-		{
-			tb->nodes = i;
-		}
+		tb->nodes = i;
 	}
 
+	tb->lastNode = i;
+
 	return i;
 }
 
+/*
+===============
+CG_SumJitters
+
+Add up the jitters of a node into one amount along each axis
+===============
+*/
+static void CG_SumJitters( trailBeam_t *tb, trailBeamNode_t *i )
+{
+	baseTrailBeam_t *btb = tb->class_;
+	int             j;
+
+	i->jitterAmount[ 0 ] = i->jitterAmount[ 1 ] = 0.0f;
+
+	for ( j = 0; j < btb->numJitters; j++ )
+	{
+		i->jitterAmount[ 0 ] += i->jitters[ j ][ 0 ];
+		i->jitterAmount[ 1 ] += i->jitters[ j ][ 1 ];
+	}
+}
+
+/*
+===============
+CG_CalculateJitterOffset
+
+Turn the jitter amounts of a node into an offset across the beam as it
+is seen this frame
+===============
+*/
+static void CG_CalculateJitterOffset( trailBeamNode_t *i, vec3_t offset )
+{
+	vec3_t          forward, right, up;
+	trailBeamNode_t *prev = i->prev;
+	trailBeamNode_t *next = i->next;
+
+	if ( prev && next )
+	{
+		//this node has two neighbours
+		GetPerpendicularViewVector( cg.refdef.vieworg, next->position, prev->position, up );
+		VectorSubtract( next->position, prev->position, forward );
+	}
+	else if ( next )
+	{
+		//this is the front
+		GetPerpendicularViewVector( cg.refdef.vieworg, next->position, i->position, up );
+		VectorSubtract( next->position, i->position, forward );
+	}
+	else if ( prev )
+	{
+		//this is the back
+		GetPerpendicularViewVector( cg.refdef.vieworg, i->position, prev->position, up );
+		VectorSubtract( i->position, prev->position, forward );
+	}
+	else
+	{
+		//no direction to jitter across
+		VectorClear( offset );
+		return;
+	}
+
+	VectorNormalize( forward );
+	CrossProduct( forward, up, right );
+	VectorNormalize( right );
+
+	VectorScale( up, i->jitterAmount[ 0 ], offset );
+	VectorMA( offset, i->jitterAmount[ 1 ], right, offset );
+}
+
 /*
 ===============
 CG_ApplyJitters
+
+The summed jitter amounts are only recalculated when a jitter period
+elapsed or nodes were added. They are projected onto the view dependent
+axes every frame, since those change with the camera and the beam
 ===============
 */
 static void CG_ApplyJitters( trailBeam_t *tb )
@@ -500,7 +532,7 @@ static void CG_ApplyJitters( trailBeam_t *tb )
 	trailBeamNode_t *start;
 	trailBeamNode_t *end;
 
-	if ( !tb || !tb->nodes )
+	if ( !tb || !tb->nodes || !tb->class_->numJitters )
 	{
 		return;
 	}
@@ -519,11 +551,22 @@ static void CG_ApplyJitters( trailBeam_t *tb )
 			}
 
 			tb->nextJitterTimes[ j ] = cg.time + btb->jitters[ j ].period;
+			tb->jitterDirty = true;
 		}
 	}
 
+	if ( tb->jitterDirty )
+	{
+		for ( i = tb->nodes; i; i = i->next )
+		{
+			CG_SumJitters( tb, i );
+		}
+
+		tb->jitterDirty = false;
+	}
+
 	start = tb->nodes;
-	end = CG_FindLastBeamNode( tb );
+	end = tb->lastNode;
 
 	if ( !btb->jitterAttachments )
 	{
@@ -538,47 +581,21 @@ static void CG_ApplyJitters( trailBeam_t *tb )
 		}
 	}
 
+	// compute every offset before moving any node, the axes of a node
+	// depend on the positions of its neighbours
 	for ( i = start; i; i = i->next )
 	{
-		vec3_t          forward, right, up;
-		trailBeamNode_t *prev;
-		trailBeamNode_t *next;
-		float           upJitter = 0.0f, rightJitter = 0.0f;
-
-		prev = i->prev;
-		next = i->next;
-
-		if ( prev && next )
-		{
-			//this node has two neighbours
-			GetPerpendicularViewVector( cg.refdef.vieworg, next->position, prev->position, up );
-			VectorSubtract( next->position, prev->position, forward );
-		}
-		else if ( !prev && next )
-		{
-			//this is the front
-			GetPerpendicularViewVector( cg.refdef.vieworg, next->position, i->position, up );
-			VectorSubtract( next->position, i->position, forward );
-		}
-		else if ( prev && !next )
-		{
-			//this is the back
-			GetPerpendicularViewVector( cg.refdef.vieworg, i->position, prev->position, up );
-			VectorSubtract( i->position, prev->position, forward );
-		}
+		CG_CalculateJitterOffset( i, i->jitterOffset );
 
-		VectorNormalize( forward );
-		CrossProduct( forward, up, right );
-		VectorNormalize( right );
-
-		for ( j = 0; j < btb->numJitters; j++ )
+		if ( i == end )
 		{
-			upJitter += i->jitters[ j ][ 0 ];
-			rightJitter += i->jitters[ j ][ 1 ];
+			break;
 		}
+	}
 
-		VectorMA( i->position, upJitter, up, i->position );
-		VectorMA( i->position, rightJitter, right, i->position );
+	for ( i = start; i; i = i->next )
+	{
+		VectorAdd( i->position, i->jitterOffset, i->position );
 
 		if ( i == end )
 		{
@@ -618,12 +635,17 @@ static void CG_UpdateBeam( trailBeam_t *tb )
 	// first make sure this beam has enough nodes
 	if ( ts->destroyTime <= 0 )
 	{
-		nodesToAdd = btb->numSegments - CG_CountBeamNodes( tb ) + 1;
+		nodesToAdd = btb->numSegments - tb->numNodes + 1;
 
-		while ( nodesToAdd-- )
+		while ( nodesToAdd-- > 0 )
 		{
 			i = CG_AppendBeamNode( tb );
 
+			if ( !i )
+			{
+				break;
+			}
+
 			if ( !tb->nodes->next && CG_Attached( &ts->frontAttachment ) )
 			{
 				// this is the first node to be added
@@ -639,7 +661,7 @@ static void CG_UpdateBeam( trailBeam_t *tb )
 		}
 	}
 
-	numNodes = CG_CountBeamNodes( tb );
+	numNodes = tb->numNodes;
 
 	for ( i = tb->nodes; i; i = i->next )
 	{
@@ -653,6 +675,7 @@ static void CG_UpdateBeam( trailBeam_t *tb )
 
 		if ( ts->destroyTime > 0 && ( cg.time - ts->destroyTime ) >= btb->fadeOutTime )
 		{
+			CG_DestroyBeamNodes( tb );
 			tb->valid = false;
 			return;
 		}
@@ -681,7 +704,7 @@ static void CG_UpdateBeam( trailBeam_t *tb )
 		// beam from one attachment
 
 		// cull the trail tail
-		i = CG_FindLastBeamNode( tb );
+		i = tb->lastNode;
 
 		if ( i && i->timeLeft >= 0 )
 		{
@@ -689,7 +712,7 @@ static void CG_UpdateBeam( trailBeam_t *tb )
 
 			if ( i->timeLeft < 0 )
 			{
-				tb->nodes = CG_DestroyBeamNode( i );
+				CG_DestroyBeamNode( tb, i );
 
 				if ( !tb->nodes )
 				{
@@ -1313,6 +1336,8 @@ void CG_LoadTrailSystems()
 	numBaseTrailSystems = 0;
 	numBaseTrailBeams = 0;
 
+	CG_ResetTrailBeamNodes();
+
 	for ( i = 0; i < MAX_BASETRAIL_SYSTEMS; i++ )
 	{
 		baseTrailSystem_t *bts = &baseTrailSystems[ i ];
@@ -1313,7 +1313,7 @@ static void CG_WeaponAnimation( centity_t *cent, int *old, int *now, float *back
 	{
 		CG_BlendLerpFrame( lf );
 
-		CG_BuildAnimSkeleton( lf, &gunSkeleton, &oldGunSkeleton );
+		CG_BuildAnimSkeleton( lf, &gunSkeleton, &oldGunSkeleton, nullptr );
 	}
 }
 
@@ -604,6 +604,7 @@ namespace Beacon //this should eventually become a class
 		tagtrace_ent_t list[ MAX_GENTITIES ];
 		int i, count = 0;
 		gentity_t *ent, *reticleEnt = nullptr;
+		const float *origin;
 		vec3_t seg, delta;
 		float dot;
 
@@ -634,19 +635,22 @@ namespace Beacon //this should eventually become a class
 			if( !EntityTaggable( i, team, true ) )
 				continue;
 
-			VectorSubtract( ent->r.currentOrigin, begin, delta );
+			// clients may have been rewound by G_UnlaggedOn
+			origin = G_UnlaggedOrigin( ent );
+
+			VectorSubtract( origin, begin, delta );
 			dot = DotProduct( seg, delta ) / VectorLength( seg ) / VectorLength( delta );
 
 			if( dot < 0.9 )
 				continue;
 
-			if( !trap_InPVS( ent->r.currentOrigin, begin ) )
+			if( !trap_InPVS( origin, begin ) )
 				continue;
 
 			// LOS
 			{
 				trace_t tr;
-				trap_Trace( &tr, begin, nullptr, nullptr, ent->r.currentOrigin, skip, mask, 0 );
+				trap_Trace( &tr, begin, nullptr, nullptr, origin, skip, mask, 0 );
 				if( tr.entityNum != i )
 					continue;
 			}
@@ -10,6 +10,8 @@ BuildableComponent::BuildableComponent(Entity& entity, HealthComponent& r_Health
 
 	// TODO: Make power state a member variable.
 	entity.oldEnt->powered = true;
+
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 void BuildableComponent::HandlePrepareNetCode() {
@@ -98,6 +100,7 @@ void BuildableComponent::Think(int timeDelta) {
 				if (entity.oldEnt->creationTime + constructionTime < level.time) {
 					// Finish construction.
 					state = CONSTRUCTED;
+					G_MarkNetCodeDirty(entity.oldEnt);
 
 					// Award momentum.
 					G_AddMomentumForBuilding(entity.oldEnt);
@@ -157,6 +160,10 @@ void BuildableComponent::SetPowerState(bool powered) {
 
 	entity.oldEnt->powered = powered;
 
+	if (powered != wasPowered) {
+		G_MarkNetCodeDirty(entity.oldEnt);
+	}
+
 	if        ( powered && !wasPowered) {
 		G_SetBuildableAnim(entity.oldEnt, BANIM_POWERUP, false);
 		G_SetIdleBuildableAnim(entity.oldEnt, BANIM_IDLE1);
@@ -5,11 +5,14 @@ static Log::Logger healthLogger("sgame.health");
 
 HealthComponent::HealthComponent(Entity& entity, float maxHealth)
 	: HealthComponentBase(entity, maxHealth), health(maxHealth)
-{}
+{
+	G_MarkNetCodeDirty(entity.oldEnt);
+}
 
 // TODO: Handle rewards array.
 HealthComponent& HealthComponent::operator=(const HealthComponent& other) {
 	health = (other.health / other.maxHealth) * maxHealth;
+	G_MarkNetCodeDirty(entity.oldEnt);
 	return *this;
 }
 
@@ -18,9 +21,6 @@ void HealthComponent::HandlePrepareNetCode() {
 	gclient_t *client = entity.oldEnt->client;
 
 	if (client) {
-		if (client->ps.stats[STAT_HEALTH] != transmittedHealth) {
-			client->pers.infoChangeTime = level.time;
-		}
 		client->ps.stats[STAT_HEALTH] = transmittedHealth;
 		client->ps.stats[STAT_MAX_HEALTH] = (int)std::ceil(maxHealth);
 	} else if (entity.oldEnt->s.eType == entityType_t::ET_BUILDABLE) {
@@ -41,6 +41,7 @@ void HealthComponent::HandleHeal(float amount, gentity_t* source) {
 
 	health += amount;
 	ScaleDamageAccounts(amount);
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 void HealthComponent::HandleDamage(float amount, gentity_t* source, Util::optional<Vec3> location,
@@ -95,7 +96,7 @@ Util::optional<Vec3> direction, int flags, meansOfDeath_t meansOfDeath) {
 			{
 				vec3_t dir, push;
 
-				VectorSubtract(entity.oldEnt->r.currentOrigin, source->r.currentOrigin, dir);
+				VectorSubtract(G_UnlaggedOrigin(entity.oldEnt), source->r.currentOrigin, dir);
 				VectorNormalizeFast(dir);
 				VectorScale(dir, (amount * 10.0f), push);
 				push[ 2 ] = 64.0f;
@@ -170,9 +171,7 @@ Util::optional<Vec3> direction, int flags, meansOfDeath_t meansOfDeath) {
 
 	// Do the damage.
 	health -= take;
-
-	// Update team overlay info.
-	if (client) client->pers.infoChangeTime = level.time;
+	G_MarkNetCodeDirty(entity.oldEnt);
 
 	// TODO: Move lastDamageTime to HealthComponent.
 	entity.oldEnt->lastDamageTime = level.time;
@@ -228,6 +227,7 @@ void HealthComponent::SetHealth(float health) {
 
 	ScaleDamageAccounts(health - this->health);
 	HealthComponent::health = health;
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 void HealthComponent::SetMaxHealth(float maxHealth, bool scaleHealth) {
@@ -236,6 +236,7 @@ void HealthComponent::SetMaxHealth(float maxHealth, bool scaleHealth) {
 	healthLogger.Debug("Changing maximum health: %3.1f → %3.1f.", this->maxHealth, maxHealth);
 
 	HealthComponent::maxHealth = maxHealth;
+	G_MarkNetCodeDirty(entity.oldEnt);
 	if (scaleHealth) SetHealth(health * (this->maxHealth / maxHealth));
 }
 
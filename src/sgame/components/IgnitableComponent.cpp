@@ -51,6 +51,8 @@ IgnitableComponent::IgnitableComponent(Entity& entity, bool alwaysOnFire, Thinki
 	REGISTER_THINKER(DamageArea, ThinkingComponent::SCHEDULER_AVERAGE, 100);
 	REGISTER_THINKER(ConsiderStop, ThinkingComponent::SCHEDULER_AVERAGE, 500);
 	REGISTER_THINKER(ConsiderSpread, ThinkingComponent::SCHEDULER_AVERAGE, 500);
+
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 void IgnitableComponent::HandlePrepareNetCode() {
@@ -77,6 +79,7 @@ void IgnitableComponent::HandleIgnite(gentity_t* fireStarter) {
 	if (!onFire) {
 		onFire = true;
 		this->fireStarter = fireStarter;
+		G_MarkNetCodeDirty(entity.oldEnt);
 
 		fireLogger.Notice("Ignited.");
 	} else {
@@ -117,6 +120,7 @@ void IgnitableComponent::HandleExtinguish(int immunityTime) {
 
 	onFire = false;
 	immuneUntil = level.time + immunityTime;
+	G_MarkNetCodeDirty(entity.oldEnt);
 
 	if (alwaysOnFire) {
 		entity.FreeAt(DeferredFreeingComponent::FREE_BEFORE_THINKING);
@@ -58,6 +58,7 @@ void MGTurretComponent::HandleDie(gentity_t* killer, meansOfDeath_t meansOfDeath
 
 void MGTurretComponent::Think(int timeDelta) {
 	// Reset firing flag for now.
+	bool wasFiring = firing;
 	firing = false;
 
 	if (!GetHumanBuildableComponent().GetBuildableComponent().Active()) {
@@ -68,6 +69,8 @@ void MGTurretComponent::Think(int timeDelta) {
 			GetTurretComponent().MoveHeadToTarget(timeDelta);
 		}
 
+		if (wasFiring) G_MarkNetCodeDirty(entity.oldEnt);
+
 		return;
 	}
 
@@ -105,6 +108,8 @@ void MGTurretComponent::Think(int timeDelta) {
 		// Move head towards a non-entity target.
 		GetTurretComponent().MoveHeadToTarget(timeDelta);
 	}
+
+	if (firing != wasFiring) G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 bool MGTurretComponent::CompareTargets(Entity& a, Entity& b) {
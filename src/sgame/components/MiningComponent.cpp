@@ -39,6 +39,7 @@ void MiningComponent::HandleDie(gentity_t* killer, meansOfDeath_t meansOfDeath)
 	// Efficiency will be zero from now on.
 	currentEfficiency   = 0.0f;
 	predictedEfficiency = 0.0f;
+	G_MarkNetCodeDirty(entity.oldEnt);
 
 	// Inform neighbouring miners so they can react immediately.
 	InformNeighbors();
@@ -90,6 +91,8 @@ void MiningComponent::CalculateEfficiency() {
 
 		currentEfficiency *= interferenceMod;
 	});
+
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 void MiningComponent::InformNeighbors() {
@@ -29,8 +29,13 @@ void OvermindComponent::Think(int timeDelta) {
 	Entity* target = FindTarget();
 
 	// Save the target for network transmission.
+	gentity_t *oldTarget = storedTarget;
 	storedTarget = target ? target->oldEnt : nullptr;
 
+	if (storedTarget != oldTarget) {
+		G_MarkNetCodeDirty(entity.oldEnt);
+	}
+
 	// If target is an enemy in reach, attack it.
 	// TODO: Add LocationComponent and Utility::Distance.
 	if (target && Utility::OnOpposingTeams(entity, *target) &&
@@ -69,6 +69,15 @@ void RocketpodComponent::HandleDie(gentity_t *killer, meansOfDeath_t meansOfDeat
 }
 
 void RocketpodComponent::Think(int timeDelta) {
+	bool wasFiring = firing, wasLockingOn = lockingOn;
+
+	// Queue a network state update if the firing or lockon flags toggled.
+	auto markChanged = [&]() {
+		if (firing != wasFiring || lockingOn != wasLockingOn) {
+			G_MarkNetCodeDirty(entity.oldEnt);
+		}
+	};
+
 	firing = false;
 
 	if (!GetBuildableComponent().Active()) {
@@ -80,6 +89,7 @@ void RocketpodComponent::Think(int timeDelta) {
 		}
 
 		lockingOn = false;
+		markChanged();
 		return;
 	}
 
@@ -90,12 +100,14 @@ void RocketpodComponent::Think(int timeDelta) {
 		GetTurretComponent().MoveHeadToTarget(timeDelta);
 
 		lockingOn = false;
+		markChanged();
 		return;
 	}
 
 	// Do not move while opening shutters.
 	if (openingShuttersSince + SHUTTER_OPEN_TIME > level.time) {
 		lockingOn = false;
+		markChanged();
 		return;
 	}
 
@@ -152,6 +164,8 @@ void RocketpodComponent::Think(int timeDelta) {
 
 		lockingOn = false;
 	}
+
+	markChanged();
 }
 
 bool RocketpodComponent::CompareTargets(Entity &a, Entity &b) {
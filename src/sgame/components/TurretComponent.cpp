@@ -16,6 +16,8 @@ TurretComponent::TurretComponent(Entity& entity)
 {
 	SetBaseDirection();
 	ResetDirection();
+
+	G_MarkNetCodeDirty(entity.oldEnt);
 }
 
 TurretComponent::~TurretComponent() {
@@ -130,6 +132,8 @@ bool TurretComponent::MoveHeadToTarget(int timeDelta) {
 			timeDelta, Utility::Print(deltaAngles), Utility::Print(maxAngleChange),
 			Utility::Print(oldRelativeAimAngles), Utility::Print(relativeAimAngles), targetReached
 		);
+
+		G_MarkNetCodeDirty(entity.oldEnt);
 	}
 
 	// TODO: Move gentity_t.buildableAim to BuildableComponent.
@@ -1226,20 +1226,22 @@ void SendPendingPredictableEvents( playerState_t *ps )
 	}
 }
 
+static Cvar::Cvar<bool> g_unlaggedRelink("g_unlaggedRelink", "relink rewound clients into the world; when off, only traces clip against their rewound boxes", Cvar::NONE, true);
+
 /*
 ==============
  G_UnlaggedStore
 
- Called on every server frame.  Stores position data for the client at that
- into client->unlaggedHist[] and the time into level.unlaggedTimes[].
+ Called on every server frame.  Stores position data for all clients
+ into level.unlaggedFrames[] and the time into level.unlaggedTimes[].
  This data is used by G_UnlaggedCalc()
 ==============
 */
 void G_UnlaggedStore()
 {
-	int        i = 0;
-	gentity_t  *ent;
-	unlagged_t *save;
+	int             i, j;
+	gentity_t       *ent;
+	unlaggedFrame_t *frame;
 
 	if ( !g_unlagged.integer )
 	{
@@ -1254,12 +1256,12 @@ void G_UnlaggedStore()
 	}
 
 	level.unlaggedTimes[ level.unlaggedIndex ] = level.time;
+	frame = &level.unlaggedFrames[ level.unlaggedIndex ];
 
 	for ( i = 0; i < level.maxclients; i++ )
 	{
 		ent = &g_entities[ i ];
-		save = &ent->client->unlaggedHist[ level.unlaggedIndex ];
-		save->used = false;
+		frame->used[ i ] = false;
 
 		if ( !ent->r.linked || !( ent->r.contents & CONTENTS_BODY ) )
 		{
@@ -1271,10 +1273,14 @@ void G_UnlaggedStore()
 			continue;
 		}
 
-		VectorCopy( ent->r.mins, save->mins );
-		VectorCopy( ent->r.maxs, save->maxs );
-		VectorCopy( ent->s.pos.trBase, save->origin );
-		save->used = true;
+		for ( j = 0; j < 3; j++ )
+		{
+			frame->box[ UNLAGGED_ORIGIN + j ][ i ] = ent->s.pos.trBase[ j ];
+			frame->box[ UNLAGGED_MINS + j ][ i ] = ent->r.mins[ j ];
+			frame->box[ UNLAGGED_MAXS + j ][ i ] = ent->r.maxs[ j ];
+		}
+
+		frame->used[ i ] = true;
 	}
 }
 
@@ -1282,17 +1288,18 @@ void G_UnlaggedStore()
 ==============
  G_UnlaggedClear
 
- Mark all unlaggedHist[] markers for this client invalid.  Useful for
+ Mark all history markers for this client invalid.  Useful for
  preventing teleporting and death.
 ==============
 */
 void G_UnlaggedClear( gentity_t *ent )
 {
 	int i;
+	int clientNum = ent->s.number;
 
 	for ( i = 0; i < MAX_UNLAGGED_MARKERS; i++ )
 	{
-		ent->client->unlaggedHist[ i ].used = false;
+		level.unlaggedFrames[ i ].used[ clientNum ] = false;
 	}
 }
 
@@ -1306,12 +1313,14 @@ void G_UnlaggedClear( gentity_t *ent )
 */
 void G_UnlaggedCalc( int time, gentity_t *rewindEnt )
 {
-	int       i = 0;
-	gentity_t *ent;
-	int       startIndex = level.unlaggedIndex;
-	int       stopIndex = -1;
-	int       frameMsec = 0;
-	float     lerp = 0.5f;
+	static float          lerped[ UNLAGGED_COMPONENTS ][ MAX_CLIENTS ];
+	int                   i = 0, j;
+	gentity_t             *ent;
+	const unlaggedFrame_t *from, *to;
+	int                   startIndex = level.unlaggedIndex;
+	int                   stopIndex = -1;
+	int                   frameMsec = 0;
+	float                 lerp = 0.5f;
 
 	if ( !g_unlagged.integer )
 	{
@@ -1369,6 +1378,19 @@ void G_UnlaggedCalc( int time, gentity_t *rewindEnt )
 		       ( float ) frameMsec;
 	}
 
+	from = &level.unlaggedFrames[ startIndex ];
+	to = &level.unlaggedFrames[ stopIndex ];
+
+	// lerp every slot regardless of validity, the inner loop runs over
+	// contiguous floats and unused slots are discarded below
+	for ( j = 0; j < UNLAGGED_COMPONENTS; j++ )
+	{
+		for ( i = 0; i < level.maxclients; i++ )
+		{
+			lerped[ j ][ i ] = from->box[ j ][ i ] + lerp * ( to->box[ j ][ i ] - from->box[ j ][ i ] );
+		}
+	}
+
 	for ( i = 0; i < level.maxclients; i++ )
 	{
 		ent = &g_entities[ i ];
@@ -1393,27 +1415,18 @@ void G_UnlaggedCalc( int time, gentity_t *rewindEnt )
 			continue;
 		}
 
-		if ( !ent->client->unlaggedHist[ startIndex ].used )
+		if ( !from->used[ i ] || !to->used[ i ] )
 		{
 			continue;
 		}
 
-		if ( !ent->client->unlaggedHist[ stopIndex ].used )
+		for ( j = 0; j < 3; j++ )
 		{
-			continue;
+			ent->client->unlaggedCalc.origin[ j ] = lerped[ UNLAGGED_ORIGIN + j ][ i ];
+			ent->client->unlaggedCalc.mins[ j ] = lerped[ UNLAGGED_MINS + j ][ i ];
+			ent->client->unlaggedCalc.maxs[ j ] = lerped[ UNLAGGED_MAXS + j ][ i ];
 		}
 
-		// between two unlagged markers
-		VectorLerpTrem( lerp, ent->client->unlaggedHist[ startIndex ].mins,
-		                ent->client->unlaggedHist[ stopIndex ].mins,
-		                ent->client->unlaggedCalc.mins );
-		VectorLerpTrem( lerp, ent->client->unlaggedHist[ startIndex ].maxs,
-		                ent->client->unlaggedHist[ stopIndex ].maxs,
-		                ent->client->unlaggedCalc.maxs );
-		VectorLerpTrem( lerp, ent->client->unlaggedHist[ startIndex ].origin,
-		                ent->client->unlaggedHist[ stopIndex ].origin,
-		                ent->client->unlaggedCalc.origin );
-
 		ent->client->unlaggedCalc.used = true;
 	}
 }
@@ -1435,6 +1448,14 @@ void G_UnlaggedOff()
 		return;
 	}
 
+	// clients that were only rewound for clipping were never moved
+	for ( i = 0; i < level.numUnlaggedRewound; i++ )
+	{
+		g_entities[ level.unlaggedRewound[ i ] ].client->unlaggedRewound = false;
+	}
+
+	level.numUnlaggedRewound = 0;
+
 	for ( i = 0; i < level.maxclients; i++ )
 	{
 		ent = &g_entities[ i ];
@@ -1460,6 +1481,13 @@ void G_UnlaggedOff()
  clients.  Once finished tracing, G_UnlaggedOff() must be called to restore
  the clients' position data
 
+ By default the clients are moved and relinked into the world.  With
+ g_unlaggedRelink off they are not moved at all: they are only flagged as
+ rewound and G_CM_Trace() clips against their unlaggedCalc box directly.
+ Code running between G_UnlaggedOn() and G_UnlaggedOff() must then read
+ their position through G_UnlaggedOrigin(), and area queries such as
+ G_CM_AreaEntities() still see them at their current position.
+
  As an optimization, all clients that have an unlagged position that is
  not touchable at "range" from "muzzle" will be ignored.  This is required
  to prevent a huge amount of trap_LinkEntity() calls per user cmd.
@@ -1471,6 +1499,7 @@ void G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range )
 	int        i = 0;
 	gentity_t  *ent;
 	unlagged_t *calc;
+	bool       relink;
 
 	if ( !g_unlagged.integer )
 	{
@@ -1482,6 +1511,8 @@ void G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range )
 		return;
 	}
 
+	relink = g_unlaggedRelink.Get();
+
 	for ( i = 0; i < level.maxclients; i++ )
 	{
 		ent = &g_entities[ i ];
@@ -1492,7 +1523,7 @@ void G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range )
 			continue;
 		}
 
-		if ( ent->client->unlaggedBackup.used )
+		if ( ent->client->unlaggedBackup.used || ent->client->unlaggedRewound )
 		{
 			continue;
 		}
@@ -1519,6 +1550,13 @@ void G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range )
 			}
 		}
 
+		if ( !relink )
+		{
+			ent->client->unlaggedRewound = true;
+			level.unlaggedRewound[ level.numUnlaggedRewound++ ] = i;
+			continue;
+		}
+
 		// create a backup of the real positions
 		VectorCopy( ent->r.mins, ent->client->unlaggedBackup.mins );
 		VectorCopy( ent->r.maxs, ent->client->unlaggedBackup.maxs );
@@ -1533,6 +1571,25 @@ void G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range )
 	}
 }
 
+/*
+==============
+ G_UnlaggedOrigin
+
+ The position of an entity as seen by traces between G_UnlaggedOn() and
+ G_UnlaggedOff(), which is its rewound origin for clients that were only
+ flagged as rewound
+==============
+*/
+const float *G_UnlaggedOrigin( const gentity_t *ent )
+{
+	if ( ent->client && ent->client->unlaggedRewound )
+	{
+		return ent->client->unlaggedCalc.origin;
+	}
+
+	return ent->r.currentOrigin;
+}
+
 /*
 ==============
  G_UnlaggedDetectCollisions
@@ -2620,25 +2620,33 @@ bool G_admin_ban( gentity_t *ent )
 
 		ipmatch = true;
 
-		for ( match = level.namelogs; match; match = match->next )
+		// a whole address can be looked up directly
+		if ( ip.mask == max )
 		{
-			// skip players in the namelog who have already been banned
-			if ( match->banned )
+			match = G_namelog_find_address( &ip );
+		}
+		else
+		{
+			for ( match = level.namelogs; match; match = match->next )
 			{
-				continue;
-			}
+				// skip players in the namelog who have already been banned
+				if ( match->banned )
+				{
+					continue;
+				}
 
-			for ( i = 0; i < MAX_NAMELOG_ADDRS && match->ip[ i ].str[ 0 ]; i++ )
-			{
-				if ( G_AddressCompare( &ip, &match->ip[ i ] ) )
+				for ( i = 0; i < MAX_NAMELOG_ADDRS && match->ip[ i ].str[ 0 ]; i++ )
 				{
-					break;
+					if ( G_AddressCompare( &ip, &match->ip[ i ] ) )
+					{
+						break;
+					}
 				}
-			}
 
-			if ( i < MAX_NAMELOG_ADDRS && match->ip[ i ].str[ 0 ] )
-			{
-				break;
+				if ( i < MAX_NAMELOG_ADDRS && match->ip[ i ].str[ 0 ] )
+				{
+					break;
+				}
 			}
 		}
 
@@ -4378,15 +4386,12 @@ static bool namelog_matchip( void *namelog, const void *ip )
 
 static bool namelog_matchname( void *namelog, const void *name )
 {
-	char      match[ MAX_NAME_LENGTH ];
 	int       i;
 	namelog_t *n = ( namelog_t * ) namelog;
 
 	for ( i = 0; i < MAX_NAMELOG_NAMES && n->name[ i ][ 0 ]; i++ )
 	{
-		G_SanitiseString( n->name[ i ], match, sizeof( match ) );
-
-		if ( strstr( match, ( const char * ) name ) )
+		if ( strstr( n->sanitisedName[ i ], ( const char * ) name ) )
 		{
 			return true;
 		}
@@ -4494,7 +4499,6 @@ namelog_t *G_NamelogFromString( gentity_t *ent, char *s )
 {
 	namelog_t *p, *m = nullptr;
 	int       i, found = 0;
-	char      n2[ MAX_NAME_LENGTH ] = { "" };
 	char      s2[ MAX_NAME_LENGTH ] = { "" };
 
 	if ( !s[ 0 ] )
@@ -4518,18 +4522,7 @@ namelog_t *G_NamelogFromString( gentity_t *ent, char *s )
 		}
 		else if ( i >= MAX_CLIENTS )
 		{
-			for ( p = level.namelogs; p; p = p->next )
-			{
-				if ( p->id == i )
-				{
-					break;
-				}
-			}
-
-			if ( p )
-			{
-				return p;
-			}
+			return G_namelog_find_id( i );
 		}
 
 		return nullptr;
@@ -4538,19 +4531,17 @@ namelog_t *G_NamelogFromString( gentity_t *ent, char *s )
 	// check for a name match
 	G_SanitiseString( s, s2, sizeof( s2 ) );
 
+	// if this is an exact match to a current player
+	if ( ( p = G_namelog_find_current_name( s2 ) ) )
+	{
+		return p;
+	}
+
 	for ( p = level.namelogs; p; p = p->next )
 	{
 		for ( i = 0; i < MAX_NAMELOG_NAMES && p->name[ i ][ 0 ]; i++ )
 		{
-			G_SanitiseString( p->name[ i ], n2, sizeof( n2 ) );
-
-			// if this is an exact match to a current player
-			if ( i == p->nameOffset && p->slot > -1 && !strcmp( s2, n2 ) )
-			{
-				return p;
-			}
-
-			if ( strstr( n2, s2 ) )
+			if ( strstr( p->sanitisedName[ i ], s2 ) )
 			{
 				m = p;
 			}
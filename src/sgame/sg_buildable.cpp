@@ -1945,6 +1945,8 @@ static gentity_t *SpawnBuildable( gentity_t *builder, buildable_t buildable, con
 		             BG_Buildable( built->s.modelindex )->humanName,
 		             readable[ 0 ] ? ", replacing " : "",
 		             readable );
+
+		G_StatsBuild( builder, built );
 	}
 
 	if ( log )
@@ -2110,6 +2112,183 @@ void G_SpawnBuildable( gentity_t *ent, buildable_t buildable )
 	ent->think = SpawnBuildableThink;
 }
 
+/*
+============
+Layout cache
+
+Parsing a text layout means a sscanf and a buildable name lookup per line.
+The result is kept in layoutcache/<map>/<layout>.bin as a list of resolved
+buildables, together with the length and hash of the text it was generated
+from. The cache is used as long as both still match, and regenerated
+otherwise.
+============
+*/
+#define LAYOUT_CACHE_MAGIC   0x434c5655 // "UVLC"
+#define LAYOUT_CACHE_VERSION 2
+
+struct layoutItem_t
+{
+	int    buildable;
+	vec3_t origin;
+	vec3_t angles;
+	vec3_t origin2;
+	vec3_t angles2;
+};
+
+struct layoutCacheHeader_t
+{
+	int      magic;
+	int      version;
+	int      numBuildables;  // BA_NUM_BUILDABLES, buildable numbers change with it
+	unsigned buildablesHash; // names of the buildables in number order
+	int      textLength;
+	unsigned textHash;
+	int      numItems;
+};
+
+static unsigned LayoutHash( const char *text, int len, unsigned hash = 2166136261u )
+{
+	// FNV-1a
+	for ( int i = 0; i < len; i++ )
+	{
+		hash = ( hash ^ ( byte ) text[ i ] ) * 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+============
+LayoutBuildablesHash
+
+Buildables may be reordered or renamed without changing their count, so the
+cache also records which name each stored number stood for.
+============
+*/
+static unsigned LayoutBuildablesHash()
+{
+	unsigned hash = LayoutHash( nullptr, 0 );
+
+	for ( int i = BA_NONE + 1; i < BA_NUM_BUILDABLES; i++ )
+	{
+		const char *name = BG_Buildable( i )->name;
+
+		hash = LayoutHash( name, strlen( name ) + 1, hash );
+	}
+
+	return hash;
+}
+
+static const char *LayoutCacheFileName( const char *map, const char *name )
+{
+	return va( "layoutcache/%s/%s.bin", map, name );
+}
+
+static void LayoutCacheWrite( const char *map, const char *name, int textLength, unsigned textHash,
+                              const std::vector<layoutItem_t> &items )
+{
+	fileHandle_t        f;
+	layoutCacheHeader_t header;
+
+	if ( trap_FS_FOpenFile( LayoutCacheFileName( map, name ), &f, fsMode_t::FS_WRITE ) < 0 )
+	{
+		return;
+	}
+
+	header.magic          = LAYOUT_CACHE_MAGIC;
+	header.version        = LAYOUT_CACHE_VERSION;
+	header.numBuildables  = BA_NUM_BUILDABLES;
+	header.buildablesHash = LayoutBuildablesHash();
+	header.textLength     = textLength;
+	header.textHash       = textHash;
+	header.numItems       = items.size();
+
+	trap_FS_Write( &header, sizeof( header ), f );
+
+	if ( !items.empty() )
+	{
+		trap_FS_Write( items.data(), items.size() * sizeof( layoutItem_t ), f );
+	}
+
+	trap_FS_FCloseFile( f );
+}
+
+static bool LayoutCacheRead( const char *map, const char *name, int textLength, unsigned textHash,
+                             std::vector<layoutItem_t> &items )
+{
+	fileHandle_t        f;
+	layoutCacheHeader_t header;
+	int                 len;
+	bool                valid;
+
+	len = trap_FS_FOpenFile( LayoutCacheFileName( map, name ), &f, fsMode_t::FS_READ );
+
+	if ( len < 0 )
+	{
+		return false;
+	}
+
+	valid = len >= (int) sizeof( header ) &&
+	        trap_FS_Read( &header, sizeof( header ), f ) == (int) sizeof( header ) &&
+	        header.magic == LAYOUT_CACHE_MAGIC &&
+	        header.version == LAYOUT_CACHE_VERSION &&
+	        header.numBuildables == BA_NUM_BUILDABLES &&
+	        header.buildablesHash == LayoutBuildablesHash() &&
+	        header.textLength == textLength &&
+	        header.textHash == textHash &&
+	        header.numItems >= 0 &&
+	        len == (int)( sizeof( header ) + header.numItems * sizeof( layoutItem_t ) );
+
+	if ( valid && header.numItems > 0 )
+	{
+		int dataLen = len - (int) sizeof( header );
+
+		items.resize( header.numItems );
+		valid = trap_FS_Read( items.data(), dataLen, f ) == dataLen;
+
+		for ( const layoutItem_t &item : items )
+		{
+			if ( item.buildable <= BA_NONE || item.buildable >= BA_NUM_BUILDABLES )
+			{
+				valid = false;
+			}
+		}
+	}
+
+	trap_FS_FCloseFile( f );
+
+	if ( !valid )
+	{
+		items.clear();
+	}
+
+	return valid;
+}
+
+/*
+============
+Layout list cache
+
+Keeps the result of the last layout directory listing. It is dropped when
+a layout is saved and otherwise refreshed every few minutes, so layouts
+copied to the server by hand still show up eventually.
+============
+*/
+#define LAYOUT_LIST_CACHE_TIME ( 5 * 60 * 1000 )
+
+static struct
+{
+	std::string map;
+	std::string list;
+	int         count;
+	int         time;
+} layoutListCache;
+
+static void LayoutListCacheInvalidate()
+{
+	layoutListCache.map.clear();
+}
+
 void G_LayoutSave( const char *name )
 {
 	char         map[ MAX_QPATH ];
@@ -2119,6 +2298,9 @@ void G_LayoutSave( const char *name )
 	int          i;
 	gentity_t    *ent;
 	char         *s;
+	int          textLength = 0;
+	unsigned     textHash = LayoutHash( nullptr, 0 );
+	std::vector<layoutItem_t> items;
 
 	trap_Cvar_VariableStringBuffer( "mapname", map, sizeof( map ) );
 
@@ -2142,6 +2324,8 @@ void G_LayoutSave( const char *name )
 
 	for ( i = MAX_CLIENTS; i < level.num_entities; i++ )
 	{
+		layoutItem_t item;
+
 		ent = &level.gentities[ i ];
 
 		if ( ent->s.eType != entityType_t::ET_BUILDABLE )
@@ -2163,10 +2347,26 @@ void G_LayoutSave( const char *name )
 		        ent->s.angles2[ 0 ],
 		        ent->s.angles2[ 1 ],
 		        ent->s.angles2[ 2 ] );
-		trap_FS_Write( s, strlen( s ), f );
+		len = strlen( s );
+		trap_FS_Write( s, len, f );
+
+		textHash = LayoutHash( s, len, textHash );
+		textLength += len;
+
+		// parse the line back so the cache matches what a load would produce
+		item.buildable = ent->s.modelindex;
+		sscanf( s, "%*s %f %f %f %f %f %f %f %f %f %f %f %f",
+		        &item.origin[ 0 ], &item.origin[ 1 ], &item.origin[ 2 ],
+		        &item.angles[ 0 ], &item.angles[ 1 ], &item.angles[ 2 ],
+		        &item.origin2[ 0 ], &item.origin2[ 1 ], &item.origin2[ 2 ],
+		        &item.angles2[ 0 ], &item.angles2[ 1 ], &item.angles2[ 2 ] );
+		items.push_back( item );
 	}
 
 	trap_FS_FCloseFile( f );
+
+	LayoutCacheWrite( map, name, textLength, textHash, items );
+	LayoutListCacheInvalidate();
 }
 
 int G_LayoutList( const char *map, char *list, int len )
@@ -2177,6 +2377,14 @@ int G_LayoutList( const char *map, char *list, int len )
 	int  numFiles, i, fileLen = 0, listLen;
 	int  count = 0;
 	char *filePtr;
+	int  now = trap_Milliseconds();
+
+	if ( !layoutListCache.map.empty() && !Q_stricmp( layoutListCache.map.c_str(), map ) &&
+	     now - layoutListCache.time < LAYOUT_LIST_CACHE_TIME )
+	{
+		Q_strncpyz( list, layoutListCache.list.c_str(), len );
+		return layoutListCache.count;
+	}
 
 	Q_strcat( layouts, sizeof( layouts ), S_BUILTIN_LAYOUT " " );
 	numFiles = trap_FS_GetFileList( va( "layouts/%s", map ), ".dat",
@@ -2215,6 +2423,11 @@ int G_LayoutList( const char *map, char *list, int len )
 		          count, numFiles, map );
 	}
 
+	layoutListCache.map   = map;
+	layoutListCache.list  = layouts;
+	layoutListCache.count = count + 1;
+	layoutListCache.time  = now;
+
 	Q_strncpyz( list, layouts, len );
 	return count + 1;
 }
@@ -2321,13 +2534,11 @@ void G_LayoutLoad()
 	char         *layout, *layoutHead;
 	char         map[ MAX_QPATH ];
 	char         buildName[ MAX_TOKEN_CHARS ];
-	int          buildable;
-	vec3_t       origin = { 0.0f, 0.0f, 0.0f };
-	vec3_t       angles = { 0.0f, 0.0f, 0.0f };
-	vec3_t       origin2 = { 0.0f, 0.0f, 0.0f };
-	vec3_t       angles2 = { 0.0f, 0.0f, 0.0f };
+	layoutItem_t item;
 	char         line[ MAX_STRING_CHARS ];
 	int          i = 0;
+	unsigned     textHash;
+	std::vector<layoutItem_t> items;
 	const buildableAttributes_t *attr;
 
 	if ( !level.layout[ 0 ] || !Q_stricmp( level.layout, S_BUILTIN_LAYOUT ) )
@@ -2349,47 +2560,65 @@ void G_LayoutLoad()
 	layout[ len ] = '\0';
 	trap_FS_FCloseFile( f );
 
-	while ( *layout )
-	{
-		if ( i >= (int) sizeof( line ) - 1 )
-		{
-			Log::Warn( "line overflow in %s before \"%s\"",
-			          va( "layouts/%s/%s.dat", map, level.layout ), line );
-			break;
-		}
+	textHash = LayoutHash( layout, len );
 
-		line[ i++ ] = *layout;
-		line[ i ] = '\0';
+	if ( !LayoutCacheRead( map, level.layout, len, textHash, items ) )
+	{
+		VectorClear( item.origin );
+		VectorClear( item.angles );
+		VectorClear( item.origin2 );
+		VectorClear( item.angles2 );
 
-		if ( *layout == '\n' )
+		while ( *layout )
 		{
-			i = 0;
-			sscanf( line, "%s %f %f %f %f %f %f %f %f %f %f %f %f\n",
-			        buildName,
-			        &origin[ 0 ], &origin[ 1 ], &origin[ 2 ],
-			        &angles[ 0 ], &angles[ 1 ], &angles[ 2 ],
-			        &origin2[ 0 ], &origin2[ 1 ], &origin2[ 2 ],
-			        &angles2[ 0 ], &angles2[ 1 ], &angles2[ 2 ] );
-
-			attr = BG_BuildableByName( buildName );
-			buildable = attr->number;
-
-			if ( buildable <= BA_NONE || buildable >= BA_NUM_BUILDABLES )
+			if ( i >= (int) sizeof( line ) - 1 )
 			{
-				Log::Warn( "bad buildable name (%s) in layout."
-				          " skipping", buildName );
+				Log::Warn( "line overflow in %s before \"%s\"",
+				          va( "layouts/%s/%s.dat", map, level.layout ), line );
+				break;
 			}
-			else
+
+			line[ i++ ] = *layout;
+			line[ i ] = '\0';
+
+			if ( *layout == '\n' )
 			{
-				LayoutBuildItem( (buildable_t) buildable, origin, angles, origin2, angles2 );
-				level.team[ attr->team ].layoutBuildPoints += attr->buildPoints;
+				i = 0;
+				sscanf( line, "%s %f %f %f %f %f %f %f %f %f %f %f %f\n",
+				        buildName,
+				        &item.origin[ 0 ], &item.origin[ 1 ], &item.origin[ 2 ],
+				        &item.angles[ 0 ], &item.angles[ 1 ], &item.angles[ 2 ],
+				        &item.origin2[ 0 ], &item.origin2[ 1 ], &item.origin2[ 2 ],
+				        &item.angles2[ 0 ], &item.angles2[ 1 ], &item.angles2[ 2 ] );
+
+				item.buildable = BG_BuildableByName( buildName )->number;
+
+				if ( item.buildable <= BA_NONE || item.buildable >= BA_NUM_BUILDABLES )
+				{
+					Log::Warn( "bad buildable name (%s) in layout."
+					          " skipping", buildName );
+				}
+				else
+				{
+					items.push_back( item );
+				}
 			}
+
+			layout++;
 		}
 
-		layout++;
+		LayoutCacheWrite( map, level.layout, len, textHash, items );
 	}
 
 	BG_Free( layoutHead );
+
+	for ( layoutItem_t &it : items )
+	{
+		attr = BG_Buildable( it.buildable );
+
+		LayoutBuildItem( (buildable_t) it.buildable, it.origin, it.angles, it.origin2, it.angles2 );
+		level.team[ attr->team ].layoutBuildPoints += attr->buildPoints;
+	}
 }
 
 void G_BaseSelfDestruct( team_t team )
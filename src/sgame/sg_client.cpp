@@ -71,8 +71,6 @@ void G_AddCreditToClient( gclient_t *client, short credit, bool cap )
 
 	// Copy to ps so the client can access it
 	client->ps.persistant[ PERS_CREDIT ] = client->pers.credit;
-
-	client->pers.infoChangeTime = level.time;
 }
 
 /*
@@ -1916,8 +1914,6 @@ void ClientSpawn( gentity_t *ent, gentity_t *spawn, const vec3_t origin, const v
 	// clear entity state values
 	BG_PlayerStateToEntityState( &client->ps, &ent->s, true );
 
-	client->pers.infoChangeTime = level.time;
-
 	// (re)tag the client for its team
 	Beacon::DeleteTags( ent );
 	Beacon::Tag( ent, (team_t)ent->client->ps.persistant[ PERS_TEAM ], true );
@@ -190,6 +190,47 @@ bool G_CM_inPVSIgnorePortals( const vec3_t p1, const vec3_t p2 )
 	return true;
 }
 
+/*
+=================
+G_CM_NumClusters
+=================
+*/
+int G_CM_NumClusters()
+{
+	return CM_NumClusters();
+}
+
+/*
+=================
+G_CM_PointCluster
+=================
+*/
+int G_CM_PointCluster( const vec3_t p )
+{
+	return CM_LeafCluster( CM_PointLeafnum( p ) );
+}
+
+/*
+=================
+G_CM_ClusterInPVS
+
+Does NOT check portalareas
+=================
+*/
+bool G_CM_ClusterInPVS( int cluster1, int cluster2 )
+{
+	byte *mask;
+
+	if ( cluster1 < 0 || cluster2 < 0 )
+	{
+		return true;
+	}
+
+	mask = CM_ClusterPVS( cluster1 );
+
+	return !mask || ( mask[ cluster2 >> 3 ] & ( 1 << ( cluster2 & 7 ) ) );
+}
+
 /*
 ========================
 G_CM_AdjustAreaPortalState
@@ -762,6 +803,104 @@ void G_CM_ClipToEntity( trace_t *trace, const vec3_t start, const vec3_t mins, c
 // FIXME: Copied from cm_local.h
 #define BOX_MODEL_HANDLE ( MAX_SUBMODELS + 1 )
 
+/*
+====================
+G_CM_ClipMergeTrace
+
+Folds the trace against a single entity into the result of the move.
+====================
+*/
+static void G_CM_ClipMergeTrace( moveclip_t *clip, trace_t *trace, int entityNum )
+{
+	if ( trace->allsolid )
+	{
+		clip->trace.allsolid = true;
+		trace->entityNum = entityNum;
+	}
+	else if ( trace->startsolid )
+	{
+		clip->trace.startsolid = true;
+		trace->entityNum = entityNum;
+	}
+
+	if ( trace->fraction < clip->trace.fraction )
+	{
+		bool oldStart;
+
+		// make sure we keep a startsolid from a previous trace
+		oldStart = clip->trace.startsolid;
+
+		trace->entityNum = entityNum;
+		clip->trace = *trace;
+		clip->trace.startsolid |= oldStart;
+	}
+}
+
+/*
+====================
+G_CM_ClipMoveToRewoundClients
+
+Clips against the lag compensated boxes of the clients flagged by
+G_UnlaggedOn(), without them being relinked into the world sectors.
+====================
+*/
+static void G_CM_ClipMoveToRewoundClients( moveclip_t *clip )
+{
+	int              i, j;
+	gentity_t        *touch;
+	const unlagged_t *calc;
+	trace_t          trace;
+	clipHandle_t     clipHandle;
+
+	for ( i = 0; i < level.numUnlaggedRewound; i++ )
+	{
+		if ( clip->trace.allsolid )
+		{
+			return;
+		}
+
+		touch = &g_entities[ level.unlaggedRewound[ i ] ];
+		calc = &touch->client->unlaggedCalc;
+
+		if ( touch->s.number == clip->passEntityNum )
+		{
+			continue;
+		}
+
+		if ( !( clip->contentmask & touch->r.contents ) )
+		{
+			continue;
+		}
+
+		if ( clip->skipmask & touch->r.contents )
+		{
+			continue;
+		}
+
+		// cheap rejection against the bounds of the entire move
+		for ( j = 0; j < 3; j++ )
+		{
+			if ( calc->origin[ j ] + calc->mins[ j ] > clip->boxmaxs[ j ] ||
+			     calc->origin[ j ] + calc->maxs[ j ] < clip->boxmins[ j ] )
+			{
+				break;
+			}
+		}
+
+		if ( j < 3 )
+		{
+			continue;
+		}
+
+		clipHandle = CM_TempBoxModel( calc->mins, calc->maxs, ( touch->r.svFlags & SVF_CAPSULE ) != 0 );
+
+		CM_TransformedBoxTrace( &trace, clip->start, clip->end, clip->mins, clip->maxs, clipHandle,
+		                        clip->contentmask, 0, calc->origin, vec3_origin, clip->collisionType );
+
+		G_CM_ClipMergeTrace( clip, &trace, touch->s.number );
+	}
+}
+
 /*
 ====================
 G_CM_ClipMoveToEntities
@@ -822,6 +961,12 @@ void G_CM_ClipMoveToEntities( moveclip_t *clip )
 			}
 		}
 
+		// rewound clients are tested against their unlagged box afterwards
+		if ( touch->client && touch->client->unlaggedRewound )
+		{
+			continue;
+		}
+
 		// if it doesn't have any brushes of a type we
 		// are looking for, ignore it
 		if ( !( clip->contentmask & touch->r.contents ) )
@@ -848,29 +993,10 @@ void G_CM_ClipMoveToEntities( moveclip_t *clip )
 		CM_TransformedBoxTrace( &trace, clip->start, clip->end, clip->mins, clip->maxs, clipHandle,
 		                        clip->contentmask, 0, origin, angles, clip->collisionType );
 
-		if ( trace.allsolid )
-		{
-			clip->trace.allsolid = true;
-			trace.entityNum = touch->s.number;
-		}
-		else if ( trace.startsolid )
-		{
-			clip->trace.startsolid = true;
-			trace.entityNum = touch->s.number;
-		}
-
-		if ( trace.fraction < clip->trace.fraction )
-		{
-			bool oldStart;
-
-			// make sure we keep a startsolid from a previous trace
-			oldStart = clip->trace.startsolid;
-
-			trace.entityNum = touch->s.number;
-			clip->trace = trace;
-			clip->trace.startsolid |= oldStart;
-		}
+		G_CM_ClipMergeTrace( clip, &trace, touch->s.number );
 	}
+
+	G_CM_ClipMoveToRewoundClients( clip );
 }
 
 /*
@@ -93,6 +93,14 @@ bool G_CM_inPVS( const vec3_t p1, const vec3_t p2 );
 
 bool G_CM_inPVSIgnorePortals( const vec3_t p1, const vec3_t p2 );
 
+int  G_CM_NumClusters();
+
+// returns -1 for points outside of any cluster
+int  G_CM_PointCluster( const vec3_t p );
+
+// like G_CM_inPVSIgnorePortals, for points already resolved to clusters
+bool G_CM_ClusterInPVS( int cluster1, int cluster2 );
+
 void G_CM_AdjustAreaPortalState( gentity_t *ent, bool open );
 
 bool G_CM_EntityContact( const vec3_t mins, const vec3_t maxs, const gentity_t *gEnt, traceType_t type );
@@ -329,22 +329,26 @@ int G_ClientNumbersFromString( const char *s, int *plist, int max )
 ==================
 ScoreboardMessage
 
+Sends the scoreboard to a client.  Once the client holds a scoreboard, only
+the rows that changed since the last one are sent in a "scoresd" command,
+along with the rank order if it changed.  Nothing is sent if nothing changed.
 ==================
 */
 void ScoreboardMessage( gentity_t *ent )
 {
-	char      entry[ 1024 ];
-	char      string[ 1400 ];
-	int       stringlength;
-	int       i, j;
-	gclient_t *cl;
-	int       numSorted;
-	weapon_t  weapon = WP_NONE;
-	upgrade_t upgrade = UP_NONE;
-
-	// send the latest information on all clients
-	string[ 0 ] = 0;
-	stringlength = 0;
+	char            entry[ 1024 ];
+	char            string[ 1400 ];
+	int             stringlength;
+	int             i, j;
+	gclient_t       *cl;
+	int             clientNum;
+	int             numSorted;
+	weapon_t        weapon = WP_NONE;
+	upgrade_t       upgrade = UP_NONE;
+	scoreboardRow_t rows[ MAX_CLIENTS ];
+	bool            known[ MAX_CLIENTS ] = { false };
+	bool            orderChanged;
+	clientPersistant_t *pers = &ent->client->pers;
 
 	numSorted = level.numConnectedClients;
 
@@ -400,23 +404,149 @@ void ScoreboardMessage( gentity_t *ent )
 			upgrade = UP_NONE;
 		}
 
+		rows[ i ].score = cl->ps.persistant[ PERS_SCORE ];
+		rows[ i ].ping = ping;
+		rows[ i ].time = ( level.time - cl->pers.enterTime ) / 60000;
+		rows[ i ].weapon = weapon;
+		rows[ i ].upgrade = upgrade;
+	}
+
+	// work out whether the order of the rows changed
+	orderChanged = ( numSorted != pers->scoreboardNumRows );
+
+	for ( i = 0; i < pers->scoreboardNumRows; i++ )
+	{
+		known[ pers->scoreboardOrder[ i ] ] = true;
+
+		if ( !orderChanged && pers->scoreboardOrder[ i ] != level.sortedClients[ i ] )
+		{
+			orderChanged = true;
+		}
+	}
+
+	// send the rank order if it changed, then the rows that changed
+	string[ 0 ] = 0;
+	stringlength = 0;
+
+	if ( pers->scoreboardSeq && orderChanged )
+	{
+		Com_sprintf( string, sizeof( string ), " %d", numSorted );
+		stringlength = strlen( string );
+
+		for ( i = 0; i < numSorted; i++ )
+		{
+			Com_sprintf( entry, sizeof( entry ), " %d", level.sortedClients[ i ] );
+
+			j = strlen( entry );
+
+			if ( stringlength + j >= (int) sizeof( string ) )
+			{
+				break;
+			}
+
+			strcpy( string + stringlength, entry );
+			stringlength += j;
+		}
+
+		if ( i < numSorted )
+		{
+			// no room for a delta, send the whole scoreboard instead
+			pers->scoreboardSeq = 0;
+			string[ 0 ] = 0;
+			stringlength = 0;
+		}
+	}
+	else if ( pers->scoreboardSeq )
+	{
+		strcpy( string, " -1" );
+		stringlength = strlen( string );
+	}
+
+	for ( i = 0; i < numSorted; i++ )
+	{
+		clientNum = level.sortedClients[ i ];
+
+		if ( pers->scoreboardSeq && known[ clientNum ] &&
+		     !memcmp( &pers->scoreboardRows[ clientNum ], &rows[ i ], sizeof( scoreboardRow_t ) ) )
+		{
+			continue;
+		}
+
 		Com_sprintf( entry, sizeof( entry ),
-		             " %d %d %d %d %d %d", level.sortedClients[ i ], cl->ps.persistant[ PERS_SCORE ],
-		             ping, ( level.time - cl->pers.enterTime ) / 60000, weapon, upgrade );
+		             " %d %d %d %d %d %d", clientNum, rows[ i ].score,
+		             rows[ i ].ping, rows[ i ].time, rows[ i ].weapon, rows[ i ].upgrade );
 
 		j = strlen( entry );
 
 		if ( stringlength + j >= (int) sizeof( string ) )
 		{
+			if ( pers->scoreboardSeq )
+			{
+				// the delta doesn't fit, send the whole scoreboard instead
+				pers->scoreboardSeq = 0;
+				ScoreboardMessage( ent );
+				return;
+			}
+
 			break;
 		}
 
 		strcpy( string + stringlength, entry );
 		stringlength += j;
+		pers->scoreboardRows[ clientNum ] = rows[ i ];
+	}
+
+	if ( pers->scoreboardSeq )
+	{
+		// nothing changed at all
+		if ( !orderChanged && !strcmp( string, " -1" ) &&
+		     pers->scoreboardKills[ 0 ] == level.team[ TEAM_ALIENS ].kills &&
+		     pers->scoreboardKills[ 1 ] == level.team[ TEAM_HUMANS ].kills )
+		{
+			return;
+		}
+
+		trap_SendServerCommand( ent - g_entities, va( "scoresd %i %i %i %i%s",
+		                        pers->scoreboardSeq + 1, pers->scoreboardSeq,
+		                        level.team[ TEAM_ALIENS ].kills, level.team[ TEAM_HUMANS ].kills, string ) );
+	}
+	else
+	{
+		// only the rows that fit were sent
+		numSorted = i;
+
+		trap_SendServerCommand( ent - g_entities, va( "scores %i %i %i%s",
+		                        pers->scoreboardSeq + 1,
+		                        level.team[ TEAM_ALIENS ].kills, level.team[ TEAM_HUMANS ].kills, string ) );
+	}
+
+	pers->scoreboardSeq++;
+	pers->scoreboardKills[ 0 ] = level.team[ TEAM_ALIENS ].kills;
+	pers->scoreboardKills[ 1 ] = level.team[ TEAM_HUMANS ].kills;
+	pers->scoreboardNumRows = numSorted;
+	memcpy( pers->scoreboardOrder, level.sortedClients, numSorted * sizeof( int ) );
+}
+
+/*
+==================
+Cmd_Score_f
+
+The client tells which scoreboard it holds, if it is not the one we last
+sent it, send it a whole one.
+==================
+*/
+static void Cmd_Score_f( gentity_t *ent )
+{
+	char seq[ 16 ];
+
+	trap_Argv( 1, seq, sizeof( seq ) );
+
+	if ( atoi( seq ) != ent->client->pers.scoreboardSeq )
+	{
+		ent->client->pers.scoreboardSeq = 0;
 	}
 
-	trap_SendServerCommand( ent - g_entities, va( "scores %i %i%s",
-	                        level.team[ TEAM_ALIENS ].kills, level.team[ TEAM_HUMANS ].kills, string ) );
+	ScoreboardMessage( ent );
 }
 
 /*
@@ -2951,7 +3081,6 @@ void Cmd_Sell_f( gentity_t *ent )
 	if ( updated )
 	{
 		ClientUserinfoChanged( ent->client->ps.clientNum, false );
-		ent->client->pers.infoChangeTime = level.time;
 	}
 }
 
@@ -3236,7 +3365,6 @@ void Cmd_Buy_f( gentity_t *ent )
 	if ( updated )
 	{
 		ClientUserinfoChanged( ent->client->ps.clientNum, false );
-		ent->client->pers.infoChangeTime = level.time;
 	}
 }
 
@@ -4321,7 +4449,7 @@ static const commands_t cmds[] =
 	{ "say_area",        CMD_MESSAGE | CMD_TEAM | CMD_ALIVE,  Cmd_SayArea_f          },
 	{ "say_area_team",   CMD_MESSAGE | CMD_TEAM | CMD_ALIVE,  Cmd_SayAreaTeam_f      },
 	{ "say_team",        CMD_MESSAGE | CMD_INTERMISSION,      Cmd_Say_f              },
-	{ "score",           CMD_INTERMISSION,                    ScoreboardMessage      },
+	{ "score",           CMD_INTERMISSION,                    Cmd_Score_f            },
 	{ "sell",            CMD_HUMAN | CMD_ALIVE,               Cmd_Sell_f             },
 	{ "setviewpos",      CMD_CHEAT_TEAM,                      Cmd_SetViewpos_f       },
 	{ "team",            0,                                   Cmd_Team_f             },
@@ -102,7 +102,7 @@ static void AddScoreHelper( gentity_t *self, float score )
 
 	self->client->ps.persistant[ PERS_SCORE ] += ( int )( score + 0.5f );
 
-	CalculateRanks();
+	CalculateClientRank( self->s.number );
 }
 
 /**
@@ -398,6 +398,8 @@ void G_PlayerDie( gentity_t *self, gentity_t *inflictor, gentity_t *attacker, in
 		             self->client->pers.netname );
 	}
 
+	G_StatsKill( self, attacker, meansOfDeath, assistant, assistantTeam );
+
 	// deactivate all upgrades
 	for ( i = UP_NONE + 1; i < UP_NUM_UPGRADES; i++ )
 	{
@@ -567,8 +569,6 @@ void G_PlayerDie( gentity_t *self, gentity_t *inflictor, gentity_t *attacker, in
 	Beacon::DetachTags( self );
 
 	trap_LinkEntity( self );
-
-	self->client->pers.infoChangeTime = level.time;
 }
 
 static int ParseDmgScript( damageRegion_t *regions, const char *buf )
@@ -1058,6 +1058,7 @@ void G_LogDestruction( gentity_t *self, gentity_t *actor, int mod )
 	}
 
 	G_BuildLogAuto( actor, self, fate );
+	G_StatsDestroy( self, actor, mod, fate );
 
 	// don't log when marked structures are removed
 	if ( mod == MOD_REPLACE )
@@ -431,8 +431,33 @@ static cvarTable_t gameCvarTable[] =
 
 static const size_t gameCvarTableSize = ARRAY_LEN( gameCvarTable );
 
+/*
+ * Side effects of cvar changes. G_UpdateCvars only runs these for the cvars
+ * that were modified, so nothing has to check its cvars every frame.
+ */
+typedef struct
+{
+	vmCvar_t *vmCvar;
+	void     ( *changed )();
+} cvarHandler_t;
+
+static void G_UpdateNeedPass();
+
+static const cvarHandler_t gameCvarHandlers[] =
+{
+	{ &g_disabledBuildables, BG_InitAllowedGameElements },
+	{ &g_disabledClasses,    BG_InitAllowedGameElements },
+	{ &g_disabledEquipment,  BG_InitAllowedGameElements },
+	{ &g_password,           G_UpdateNeedPass },
+	{ &g_synchronousClients, G_CheckPmoveParamChanges },
+	{ &pmove_accurate,       G_CheckPmoveParamChanges },
+	{ &pmove_fixed,          G_CheckPmoveParamChanges },
+	{ &pmove_msec,           G_CheckPmoveParamChanges },
+};
+
 void               CheckExitRules();
 static void        G_LogGameplayStats( int state );
+static void        G_LogFlush( bool force );
 
 // state field of G_LogGameplayStats
 enum
@@ -564,17 +589,63 @@ void G_RegisterCvars()
 			}
 		}
 	}
+
+	G_UpdateNeedPass();
+}
+
+/*
+=================
+G_CvarChanged
+
+Announces a modified cvar and queues the side effects of the change.
+=================
+*/
+static void G_CvarChanged( cvarTable_t *cv, void ( **pending )(), int *numPending )
+{
+	if ( cv->trackChange )
+	{
+		trap_SendServerCommand( -1, va( "print_tr %s %s %s", QQ( N_("Server: $1$ changed to $2$") ),
+		                                Quote( cv->cvarName ), Quote( cv->vmCvar->string ) ) );
+	}
+
+	if ( !level.spawning && cv->explicit_ )
+	{
+		strcpy( cv->explicit_, cv->vmCvar->string );
+	}
+
+	for ( const cvarHandler_t &handler : gameCvarHandlers )
+	{
+		if ( handler.vmCvar != cv->vmCvar )
+		{
+			continue;
+		}
+
+		// several cvars may share a handler, run it once
+		int i;
+
+		for ( i = 0; i < *numPending && pending[ i ] != handler.changed; i++ );
+
+		if ( i == *numPending )
+		{
+			pending[ ( *numPending )++ ] = handler.changed;
+		}
+	}
 }
 
 /*
 =================
 G_UpdateCvars
+
+Fetches cvar changes from the engine and dispatches the side effects of the
+modified ones.
 =================
 */
 void G_UpdateCvars()
 {
 	unsigned i;
 	cvarTable_t *cv;
+	void     ( *pending[ ARRAY_LEN( gameCvarHandlers ) ] )();
+	int      numPending = 0;
 
 	for ( i = 0, cv = gameCvarTable; i < gameCvarTableSize; i++, cv++ )
 	{
@@ -585,20 +656,15 @@ void G_UpdateCvars()
 			if ( cv->modificationCount != cv->vmCvar->modificationCount )
 			{
 				cv->modificationCount = cv->vmCvar->modificationCount;
-
-				if ( cv->trackChange )
-				{
-					trap_SendServerCommand( -1, va( "print_tr %s %s %s", QQ( N_("Server: $1$ changed to $2$") ),
-					                                Quote( cv->cvarName ), Quote( cv->vmCvar->string ) ) );
-				}
-
-				if ( !level.spawning && cv->explicit_ )
-				{
-					strcpy( cv->explicit_, cv->vmCvar->string );
-				}
+				G_CvarChanged( cv, pending, &numPending );
 			}
 		}
 	}
+
+	for ( int j = 0; j < numPending; j++ )
+	{
+		pending[ j ]();
+	}
 }
 
 /*
@@ -683,6 +749,10 @@ void G_InitGame( int levelTime, int randomSeed, bool inClient )
 	level.time = levelTime;
 	level.inClient = inClient;
 	level.startTime = levelTime;
+
+	// configstrings may have been changed behind our back since the last game
+	G_ResetConfigstringIndexes();
+
 	level.snd_fry = G_SoundIndex( "sound/misc/fry.wav" );  // FIXME standing in lava / slime
 
 	// TODO: Move this in a seperate function
@@ -750,6 +820,8 @@ void G_InitGame( int levelTime, int randomSeed, bool inClient )
 		}
 	}
 
+	G_StatsStreamInit();
+
 	// initialise whether bot vote kicks are allowed. the map rotation may clear this flag.
 	trap_Cvar_Set( "g_botKickVotesAllowedThisMap", g_botKickVotesAllowed.integer ? "1" : "0" );
 
@@ -822,6 +894,8 @@ void G_InitGame( int levelTime, int randomSeed, bool inClient )
 	// add any fake entities
 	G_SpawnFakeEntities();
 
+	G_InitLocationLookup();
+
 	BaseClustering::Init();
 
 	// load up a custom building layout if there is one
@@ -939,6 +1013,7 @@ void G_ShutdownGame( int /* restart */ )
 	{
 		G_LogPrintf( "ShutdownGame:" );
 		G_LogPrintf( "------------------------------------------------------------" );
+		G_LogFlush( true );
 		trap_FS_FCloseFile( level.logFile );
 		level.logFile = 0;
 	}
@@ -951,6 +1026,8 @@ void G_ShutdownGame( int /* restart */ )
 		level.logGameplayFile = 0;
 	}
 
+	G_StatsStreamShutdown();
+
 	// write all the client session data so we can get it back
 	G_WriteSessionData();
 
@@ -1011,30 +1088,40 @@ PLAYER COUNTING / SCORE SORTING
 
 /*
 =============
-SortRanks
+G_RankBefore
 
+Whether client a must be ranked above client b.
 =============
 */
-int QDECL SortRanks( const void *a, const void *b )
+static bool G_RankBefore( int a, int b )
 {
-	gclient_t *ca, *cb;
+	return level.clients[ a ].ps.persistant[ PERS_SCORE ] >
+	       level.clients[ b ].ps.persistant[ PERS_SCORE ];
+}
 
-	ca = &level.clients[ * ( int * ) a ];
-	cb = &level.clients[ * ( int * ) b ];
+/*
+=============
+G_SortRanks
 
-	// then sort by score
-	if ( ca->ps.persistant[ PERS_SCORE ] > cb->ps.persistant[ PERS_SCORE ] )
-	{
-		return -1;
-	}
+Insertion sort of level.sortedClients by score.  The list is kept sorted
+between calls, so this is linear in the common case, and it is stable so
+tied clients keep their previous order.
+=============
+*/
+static void G_SortRanks()
+{
+	int i, j, clientNum;
 
-	if ( ca->ps.persistant[ PERS_SCORE ] < cb->ps.persistant[ PERS_SCORE ] )
+	for ( i = 1; i < level.numConnectedClients; i++ )
 	{
-		return 1;
-	}
-	else
-	{
-		return 0;
+		clientNum = level.sortedClients[ i ];
+
+		for ( j = i; j > 0 && G_RankBefore( clientNum, level.sortedClients[ j - 1 ] ); j-- )
+		{
+			level.sortedClients[ j ] = level.sortedClients[ j - 1 ];
+		}
+
+		level.sortedClients[ j ] = clientNum;
 	}
 }
 
@@ -1384,8 +1471,33 @@ void CalculateRanks()
 {
 	int  clientNum;
 	int  team;
+	int  i, numRanked;
+	bool ranked[ MAX_CLIENTS ] = { false };
 	char P[ MAX_CLIENTS + 1 ] = "", B[ MAX_CLIENTS + 1 ] = "";
 
+	// keep the previous order of clients that are still connected so that
+	// re-sorting is cheap, then append the newcomers
+	numRanked = 0;
+
+	for ( i = 0; i < level.numConnectedClients; i++ )
+	{
+		clientNum = level.sortedClients[ i ];
+
+		if ( level.clients[ clientNum ].pers.connected != CON_DISCONNECTED )
+		{
+			level.sortedClients[ numRanked++ ] = clientNum;
+			ranked[ clientNum ] = true;
+		}
+	}
+
+	for ( clientNum = 0; clientNum < level.maxclients; clientNum++ )
+	{
+		if ( level.clients[ clientNum ].pers.connected != CON_DISCONNECTED && !ranked[ clientNum ] )
+		{
+			level.sortedClients[ numRanked++ ] = clientNum;
+		}
+	}
+
 	level.numConnectedClients = 0;
 	level.numPlayingClients   = 0;
 	level.numPlayingPlayers   = 0;
@@ -1407,19 +1519,7 @@ void CalculateRanks()
 
 		if ( level.clients[ clientNum ].pers.connected != CON_DISCONNECTED )
 		{
-			bool bot = false;
-			int      entNum;
-
-			for ( entNum = 0; entNum < level.num_entities; ++entNum)
-			{
-				if ( level.gentities[ clientNum ].client == &level.clients[ clientNum ] )
-				{
-					bot = ( level.gentities[ clientNum ].r.svFlags & SVF_BOT );
-					break;
-				}
-			}
-
-			level.sortedClients[ level.numConnectedClients ] = clientNum;
+			bool bot = ( level.gentities[ clientNum ].r.svFlags & SVF_BOT );
 
 			team = level.clients[ clientNum ].pers.team;
 			P[ clientNum ] = ( char ) '0' + team;
@@ -1476,8 +1576,7 @@ void CalculateRanks()
 	B[ clientNum ] = '\0';
 	trap_Cvar_Set( "B", B );
 
-	qsort( level.sortedClients, level.numConnectedClients,
-	       sizeof( level.sortedClients[ 0 ] ), SortRanks );
+	G_SortRanks();
 
 	// see if it is time to end the level
 	CheckExitRules();
@@ -1489,6 +1588,55 @@ void CalculateRanks()
 	}
 }
 
+/*
+============
+CalculateClientRank
+
+Moves a single client to its new rank after its score changed.  Unlike
+CalculateRanks this does not recount the teams, as only the score of a
+connected client is expected to have changed.
+============
+*/
+void CalculateClientRank( int clientNum )
+{
+	int i, j;
+
+	for ( i = 0; i < level.numConnectedClients; i++ )
+	{
+		if ( level.sortedClients[ i ] == clientNum )
+		{
+			break;
+		}
+	}
+
+	if ( i == level.numConnectedClients )
+	{
+		// not ranked yet
+		CalculateRanks();
+		return;
+	}
+
+	// move up past lower scores, or down past higher ones
+	for ( j = i; j > 0 && G_RankBefore( clientNum, level.sortedClients[ j - 1 ] ); j-- )
+	{
+		level.sortedClients[ j ] = level.sortedClients[ j - 1 ];
+	}
+
+	for ( ; j < level.numConnectedClients - 1 && G_RankBefore( level.sortedClients[ j + 1 ], clientNum ); j++ )
+	{
+		level.sortedClients[ j ] = level.sortedClients[ j + 1 ];
+	}
+
+	level.sortedClients[ j ] = clientNum;
+
+	CheckExitRules();
+
+	if ( level.intermissiontime )
+	{
+		SendScoreboardMessageToAllClients();
+	}
+}
+
 /*
 ========================================================================
 
@@ -1737,12 +1885,126 @@ void G_AdminMessage( gentity_t *ent, const char *msg )
 	             msg );
 }
 
+/*
+=================
+Game log buffer
+
+Lines written by G_LogPrintf are collected in a ring buffer and written to
+the log file by G_LogFlush at the end of the frame, in bounded chunks, so that
+busy frames do not turn into many small file writes. Lines that do not fit
+into the buffer are dropped and counted.
+=================
+*/
+#define LOG_BUFFER_SIZE ( 64 * 1024 )
+
+static Cvar::Cvar<int> g_logFlushInterval("g_logFlushInterval", "maximum time in ms that game log lines stay buffered", Cvar::NONE, 1000);
+static Cvar::Cvar<int> g_logFlushChunk("g_logFlushChunk", "maximum number of bytes written to the game log per frame", Cvar::NONE, 16384);
+
+static struct
+{
+	char   data[ LOG_BUFFER_SIZE ];
+	size_t head; // first byte not yet written to disk
+	size_t used; // number of bytes waiting
+	int    lastFlush;
+	int    droppedLines;
+} logBuffer;
+
+static void G_LogBufferAppend( const char *line, size_t len )
+{
+	size_t tail, part;
+
+	// keep whole lines only
+	if ( logBuffer.used + len + 1 > LOG_BUFFER_SIZE )
+	{
+		logBuffer.droppedLines++;
+		return;
+	}
+
+	tail = ( logBuffer.head + logBuffer.used ) % LOG_BUFFER_SIZE;
+	part = std::min( len, LOG_BUFFER_SIZE - tail );
+
+	memcpy( logBuffer.data + tail, line, part );
+	memcpy( logBuffer.data, line + part, len - part );
+
+	logBuffer.data[ ( tail + len ) % LOG_BUFFER_SIZE ] = '\n';
+	logBuffer.used += len + 1;
+}
+
+static void G_LogBufferWrite( size_t bytes )
+{
+	while ( bytes > 0 && logBuffer.used > 0 )
+	{
+		size_t part = std::min( { bytes, logBuffer.used, LOG_BUFFER_SIZE - logBuffer.head } );
+
+		trap_FS_Write( logBuffer.data + logBuffer.head, part, level.logFile );
+
+		logBuffer.head = ( logBuffer.head + part ) % LOG_BUFFER_SIZE;
+		logBuffer.used -= part;
+		bytes -= part;
+	}
+
+	if ( logBuffer.used == 0 )
+	{
+		logBuffer.head = 0;
+	}
+}
+
+/*
+=================
+G_LogFlush
+
+Writes buffered log lines to disk. Unless forced, at most g_logFlushChunk bytes
+are written, and only once that much is pending or g_logFlushInterval passed.
+=================
+*/
+static void G_LogFlush( bool force )
+{
+	int now = trap_Milliseconds();
+
+	if ( !level.logFile )
+	{
+		logBuffer.head = logBuffer.used = 0;
+		return;
+	}
+
+	if ( logBuffer.droppedLines )
+	{
+		int dropped = logBuffer.droppedLines;
+
+		Log::Warn( "Game log buffer overflow, %d lines dropped", dropped );
+
+		// make room for the notice so the gap is visible in the log itself
+		G_LogBufferWrite( LOG_BUFFER_SIZE );
+		logBuffer.droppedLines = 0;
+		G_LogPrintf( "LogDropped: %d", dropped );
+	}
+
+	if ( force )
+	{
+		G_LogBufferWrite( LOG_BUFFER_SIZE );
+	}
+	else if ( logBuffer.used > 0 )
+	{
+		size_t chunk = std::max( 1024, g_logFlushChunk.Get() );
+
+		if ( logBuffer.used < chunk && now - logBuffer.lastFlush < g_logFlushInterval.Get() )
+		{
+			return;
+		}
+
+		G_LogBufferWrite( chunk );
+	}
+
+	logBuffer.lastFlush = now;
+}
+
 /*
 =================
 G_LogPrintf
 
 Print to the logfile with a time stamp if it is open, and to the server console.
-Will append a newline for you.
+Will append a newline for you. The logfile is written by G_LogFlush, except
+with g_logFileSync enabled.
 =================
 */
 void QDECL PRINTF_LIKE(1) G_LogPrintf( const char *fmt, ... )
@@ -1779,8 +2041,17 @@ void QDECL PRINTF_LIKE(1) G_LogPrintf( const char *fmt, ... )
 	}
 
 	Color::StripColors( string, decolored, sizeof( decolored ) );
-	trap_FS_Write( decolored, strlen( decolored ), level.logFile );
-    trap_FS_Write( "\n", 1, level.logFile );
+
+	if ( g_logFileSync.integer )
+	{
+		// keep ordering with anything still buffered
+		G_LogBufferWrite( LOG_BUFFER_SIZE );
+		trap_FS_Write( decolored, strlen( decolored ), level.logFile );
+		trap_FS_Write( "\n", 1, level.logFile );
+		return;
+	}
+
+	G_LogBufferAppend( decolored, strlen( decolored ) );
 }
 
 /*
@@ -1844,7 +2115,8 @@ static void G_LogGameplayStats( int state )
 
 	static int nextCalculation = 0;
 
-	if ( !level.logGameplayFile )
+	// the statistics stream samples team state along with the body
+	if ( !level.logGameplayFile && !( state == LOG_GAMEPLAY_STATS_BODY && G_StatsStreamActive() ) )
 	{
 		return;
 	}
@@ -1917,6 +2189,11 @@ static void G_LogGameplayStats( int state )
 			G_GetTotalBuildableValues( BRV );
 			GetAverageCredits( Cre, Val );
 
+			for( team = TEAM_NONE + 1; team < NUM_TEAMS; team++ )
+			{
+				G_StatsTeam( ( team_t )team, num[ team ], UBP[ team ], BRV[ team ], Cre[ team ], Val[ team ] );
+			}
+
 			Com_sprintf( logline, sizeof( logline ),
 			             "%4i %2i %2i %4i %4i %4i %4i %4i %4i %4i %4i %4i %4i %4i %4i %4i\n",
 			             time, num[ TEAM_ALIENS ], num[ TEAM_HUMANS ], Mom[ TEAM_ALIENS ], Mom[ TEAM_HUMANS ],
@@ -1968,7 +2245,10 @@ static void G_LogGameplayStats( int state )
 			return;
 	}
 
-	trap_FS_Write( logline, strlen( logline ), level.logGameplayFile );
+	if ( level.logGameplayFile )
+	{
+		trap_FS_Write( logline, strlen( logline ), level.logGameplayFile );
+	}
 
 	if ( state == LOG_GAMEPLAY_STATS_BODY )
 	{
@@ -2569,28 +2849,19 @@ void G_CheckVote( team_t team )
 
 /*
 ==================
-CheckCvars
+G_UpdateNeedPass
 ==================
 */
-void CheckCvars()
+static void G_UpdateNeedPass()
 {
-	static int lastPasswordModCount = -1;
-
-	if ( g_password.modificationCount != lastPasswordModCount )
+	if ( *g_password.string && Q_stricmp( g_password.string, "none" ) )
 	{
-		lastPasswordModCount = g_password.modificationCount;
-
-		if ( *g_password.string && Q_stricmp( g_password.string, "none" ) )
-		{
-			trap_Cvar_Set( "g_needpass", "1" );
-		}
-		else
-		{
-			trap_Cvar_Set( "g_needpass", "0" );
-		}
+		trap_Cvar_Set( "g_needpass", "1" );
+	}
+	else
+	{
+		trap_Cvar_Set( "g_needpass", "0" );
 	}
-
-	level.frameMsec = trap_Milliseconds();
 }
 
 /*
@@ -2708,6 +2979,7 @@ void G_RunFrame( int levelTime )
 	// if we are waiting for the level to restart, do nothing
 	if ( level.restarted )
 	{
+		G_LogFlush( false );
 		return;
 	}
 
@@ -2746,6 +3018,8 @@ void G_RunFrame( int levelTime )
 			level.pausedTime = 0;
 		}
 
+		// admin commands and chat are still logged while paused
+		G_LogFlush( false );
 		return;
 	}
 
@@ -2761,13 +3035,12 @@ void G_RunFrame( int levelTime )
 
 	// get any cvar changes
 	G_UpdateCvars();
-	CheckCvars();
+
+	level.frameMsec = trap_Milliseconds();
 
 	// now we are done spawning
 	level.spawning = false;
 
-	G_CheckPmoveParamChanges();
-
 	// go through all allocated objects
 	ent = &g_entities[ 0 ];
 	for ( i = 0; i < level.num_entities; i++, ent++ )
@@ -2905,14 +3178,40 @@ void G_RunFrame( int levelTime )
 	}
 
 	trap_BotUpdateObstacles();
+
+	// write out buffered log lines
+	G_LogFlush( false );
+	G_StatsStreamFrame();
+
 	level.frameMsec = trap_Milliseconds();
 }
 
+/**
+ * @brief Queues a non-client entity for G_PrepareEntityNetCode.
+ *
+ * Components call this whenever state that they transmit in HandlePrepareNetCode changes. Clients
+ * are always prepared and need not be marked.
+ */
+void G_MarkNetCodeDirty(gentity_t *ent) {
+	if (ent->netCodeQueued || ent->s.number < MAX_CLIENTS) {
+		return;
+	}
+
+	if (level.numNetCodeQueued == MAX_GENTITIES) {
+		level.netCodeQueueOverflowed = true;
+		return;
+	}
+
+	ent->netCodeQueued = true;
+	level.netCodeQueue[level.numNetCodeQueued++] = ent->s.number;
+}
+
 void G_PrepareEntityNetCode() {
 	// TODO: Allow ForEntities with empty template arguments.
 	gentity_t *oldEnt = &g_entities[0];
-	// Prepare netcode for all non-specs first.
-	for (int i = 0; i < level.num_entities; i++, oldEnt++) {
+
+	// Prepare netcode for all non-specs first. Client state changes every frame.
+	for (int i = 0; i < level.maxclients; i++, oldEnt++) {
 		if (oldEnt->entity) {
 			if (oldEnt->entity->Get<SpectatorComponent>()) {
 				continue;
@@ -2921,6 +3220,32 @@ void G_PrepareEntityNetCode() {
 		}
 	}
 
+	// Other entities only when their network state changed.
+	if (level.netCodeQueueOverflowed) {
+		for (int i = MAX_CLIENTS; i < level.num_entities; i++) {
+			oldEnt = &g_entities[i];
+
+			if (oldEnt->entity) {
+				oldEnt->entity->PrepareNetCode();
+			}
+		}
+	} else {
+		for (int i = 0; i < level.numNetCodeQueued; i++) {
+			oldEnt = &g_entities[level.netCodeQueue[i]];
+
+			if (oldEnt->inuse && oldEnt->entity) {
+				oldEnt->entity->PrepareNetCode();
+			}
+		}
+	}
+
+	for (int i = 0; i < level.numNetCodeQueued; i++) {
+		g_entities[level.netCodeQueue[i]].netCodeQueued = false;
+	}
+
+	level.numNetCodeQueued = 0;
+	level.netCodeQueueOverflowed = false;
+
 	// Prepare netcode for specs
 	ForEntities<SpectatorComponent>([&](Entity& entity, SpectatorComponent& spectatorComponent){
 		entity.PrepareNetCode();
@@ -22,6 +22,169 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "sg_local.h"
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+static Cvar::Cvar<int> g_namelogMaxEntries("g_namelogMaxEntries", "number of players the namelog remembers before forgetting the least recently seen", Cvar::NONE, 1024);
+
+/*
+ * Indexes over level.namelogs. Every change to the list or to the indexed
+ * fields of an entry goes through this file, which keeps them in sync.
+ */
+static std::unordered_multimap<std::string, namelog_t *> namelogByGuid;
+static std::unordered_multimap<std::string, namelog_t *> namelogByAddress;
+static std::unordered_multimap<std::string, namelog_t *> namelogByName; // sanitised current name
+static std::unordered_map<int, namelog_t *>              namelogById;
+
+static namelog_t *namelogTail;
+static int        namelogCount;
+static int        namelogNextId = MAX_CLIENTS;
+
+static std::string NamelogGuidKey( const char *guid )
+{
+	std::string key( guid );
+
+	for ( char &c : key )
+	{
+		c = tolower( ( unsigned char ) c );
+	}
+
+	return key;
+}
+
+// the part of an address G_AddressCompare looks at with the widest mask
+static std::string NamelogAddressKey( const addr_t *ip )
+{
+	return std::string( 1, ( char ) ip->type ) +
+	       std::string( ( const char * ) ip->addr, ip->type == IPv4 ? 4 : 8 );
+}
+
+template<typename Map, typename Key>
+static void NamelogIndexRemove( Map &index, const Key &key, const namelog_t *n )
+{
+	auto range = index.equal_range( key );
+
+	for ( auto it = range.first; it != range.second; ++it )
+	{
+		if ( it->second == n )
+		{
+			index.erase( it );
+			return;
+		}
+	}
+}
+
+static void NamelogIndexName( namelog_t *n, bool add )
+{
+	const char *name = n->sanitisedName[ n->nameOffset ];
+
+	if ( !name[ 0 ] )
+	{
+		return;
+	}
+
+	if ( add )
+	{
+		namelogByName.emplace( name, n );
+	}
+	else
+	{
+		NamelogIndexRemove( namelogByName, std::string( name ), n );
+	}
+}
+
+static void NamelogUnlink( namelog_t *n, namelog_t *prev )
+{
+	NamelogIndexRemove( namelogByGuid, NamelogGuidKey( n->guid ), n );
+
+	for ( int i = 0; i < MAX_NAMELOG_ADDRS && n->ip[ i ].str[ 0 ]; i++ )
+	{
+		NamelogIndexRemove( namelogByAddress, NamelogAddressKey( &n->ip[ i ] ), n );
+	}
+
+	NamelogIndexName( n, false );
+	namelogById.erase( n->id );
+
+	if ( prev )
+	{
+		prev->next = n->next;
+	}
+	else
+	{
+		level.namelogs = n->next;
+	}
+
+	if ( namelogTail == n )
+	{
+		namelogTail = prev;
+	}
+
+	namelogCount--;
+	BG_Free( n );
+}
+
+/*
+=================
+G_namelog_evict
+
+Forgets the least recently seen players until the namelog is within
+g_namelogMaxEntries. Connected players, muted or build-denied players and
+players still referenced by buildables or the build log are kept.
+=================
+*/
+static void G_namelog_evict()
+{
+	int max = std::max( g_namelogMaxEntries.Get(), MAX_CLIENTS );
+
+	if ( namelogCount <= max )
+	{
+		return;
+	}
+
+	std::unordered_set<const namelog_t *> referenced;
+
+	for ( int i = 0; i < MAX_BUILDLOG; i++ )
+	{
+		referenced.insert( level.buildLog[ i ].actor );
+		referenced.insert( level.buildLog[ i ].builtBy );
+	}
+
+	for ( int i = MAX_CLIENTS; i < level.num_entities; i++ )
+	{
+		if ( g_entities[ i ].inuse )
+		{
+			referenced.insert( g_entities[ i ].builtBy );
+		}
+	}
+
+	while ( namelogCount > max )
+	{
+		namelog_t *victim = nullptr, *victimPrev = nullptr;
+
+		for ( namelog_t *n = level.namelogs, *prev = nullptr; n; prev = n, n = n->next )
+		{
+			if ( n->slot != -1 || n->muted || n->denyBuild || referenced.count( n ) )
+			{
+				continue;
+			}
+
+			if ( !victim || n->lastSeen < victim->lastSeen )
+			{
+				victim = n;
+				victimPrev = prev;
+			}
+		}
+
+		if ( !victim )
+		{
+			break;
+		}
+
+		NamelogUnlink( victim, victimPrev );
+	}
+}
+
 void G_namelog_cleanup()
 {
 	namelog_t *namelog, *n;
@@ -31,24 +194,30 @@ void G_namelog_cleanup()
 		n = namelog->next;
 		BG_Free( namelog );
 	}
+
+	namelogByGuid.clear();
+	namelogByAddress.clear();
+	namelogByName.clear();
+	namelogById.clear();
+	namelogTail = nullptr;
+	namelogCount = 0;
+	namelogNextId = MAX_CLIENTS;
 }
 
 void G_namelog_connect( gclient_t *client )
 {
-	namelog_t *n, *p = nullptr;
+	namelog_t *n = nullptr;
 	int       i;
 	char      *newname;
 
-	for ( n = level.namelogs; n; p = n, n = n->next )
-	{
-		if ( n->slot != -1 )
-		{
-			continue;
-		}
+	// reuse the oldest entry of this guid that is not in use
+	auto range = namelogByGuid.equal_range( NamelogGuidKey( client->pers.guid ) );
 
-		if ( !Q_stricmp( client->pers.guid, n->guid ) )
+	for ( auto it = range.first; it != range.second; ++it )
+	{
+		if ( it->second->slot == -1 && ( !n || it->second->id < n->id ) )
 		{
-			break;
+			n = it->second;
 		}
 	}
 
@@ -56,22 +225,30 @@ void G_namelog_connect( gclient_t *client )
 	{
 		n = (namelog_t*) BG_Alloc( sizeof( namelog_t ) );
 		strcpy( n->guid, client->pers.guid );
+		n->id = namelogNextId++;
 
-		if ( p )
+		if ( namelogTail )
 		{
-			p->next = n;
-			n->id = p->id + 1;
+			namelogTail->next = n;
 		}
 		else
 		{
 			level.namelogs = n;
-			n->id = MAX_CLIENTS;
 		}
+
+		namelogTail = n;
+		namelogCount++;
+
+		namelogByGuid.emplace( NamelogGuidKey( n->guid ), n );
+		namelogById.emplace( n->id, n );
 	}
 
 	client->pers.namelog = n;
 	n->slot = client - level.clients;
 	n->banned = false;
+	n->lastSeen = level.time;
+
+	G_namelog_evict();
 
 	newname = n->name[ n->nameOffset ];
 
@@ -94,9 +271,11 @@ void G_namelog_connect( gclient_t *client )
 	if ( i == MAX_NAMELOG_ADDRS )
 	{
 		i--;
+		NamelogIndexRemove( namelogByAddress, NamelogAddressKey( &n->ip[ i ] ), n );
 	}
 
 	memcpy( &n->ip[ i ], &client->pers.ip, sizeof( n->ip[ i ] ) );
+	namelogByAddress.emplace( NamelogAddressKey( &n->ip[ i ] ), n );
 }
 
 void G_namelog_disconnect( gclient_t *client )
@@ -107,6 +286,7 @@ void G_namelog_disconnect( gclient_t *client )
 	}
 
 	client->pers.namelog->slot = -1;
+	client->pers.namelog->lastSeen = level.time;
 	client->pers.namelog = nullptr;
 }
 
@@ -126,22 +306,23 @@ void G_namelog_update_score( gclient_t *client )
 
 void G_namelog_update_name( gclient_t *client )
 {
-	char      n1[ MAX_NAME_LENGTH ], n2[ MAX_NAME_LENGTH ];
+	char      n1[ MAX_NAME_LENGTH ];
 	namelog_t *n = client->pers.namelog;
 
+	G_SanitiseString( client->pers.netname, n1, sizeof( n1 ) );
+	NamelogIndexName( n, false );
+
 	if ( n->name[ n->nameOffset ][ 0 ] )
 	{
-		G_SanitiseString( client->pers.netname, n1, sizeof( n1 ) );
-		G_SanitiseString( n->name[ n->nameOffset ],
-		                  n2, sizeof( n2 ) );
-
-		if ( strcmp( n1, n2 ) != 0 )
+		if ( strcmp( n1, n->sanitisedName[ n->nameOffset ] ) != 0 )
 		{
 			n->nameOffset = ( n->nameOffset + 1 ) % MAX_NAMELOG_NAMES;
 		}
 	}
 
 	strcpy( n->name[ n->nameOffset ], client->pers.netname );
+	strcpy( n->sanitisedName[ n->nameOffset ], n1 );
+	NamelogIndexName( n, true );
 }
 
 void G_namelog_restore( gclient_t *client )
@@ -153,3 +334,62 @@ void G_namelog_restore( gclient_t *client )
 	client->ps.persistant[ PERS_CREDIT ] = 0;
 	G_AddCreditToClient( client, n->credits, false );
 }
+
+/*
+=================
+G_namelog_find_id
+=================
+*/
+namelog_t *G_namelog_find_id( int id )
+{
+	auto it = namelogById.find( id );
+
+	return it != namelogById.end() ? it->second : nullptr;
+}
+
+/*
+=================
+G_namelog_find_address
+
+Returns the oldest entry that is not banned and has used the given address,
+or nullptr. The address must not be masked.
+=================
+*/
+namelog_t *G_namelog_find_address( const addr_t *ip )
+{
+	namelog_t *match = nullptr;
+	auto      range = namelogByAddress.equal_range( NamelogAddressKey( ip ) );
+
+	for ( auto it = range.first; it != range.second; ++it )
+	{
+		if ( !it->second->banned && ( !match || it->second->id < match->id ) )
+		{
+			match = it->second;
+		}
+	}
+
+	return match;
+}
+
+/*
+=================
+G_namelog_find_current_name
+
+Returns a connected player whose current sanitised name is exactly the given
+one, or nullptr.
+=================
+*/
+namelog_t *G_namelog_find_current_name( const char *sanitisedName )
+{
+	auto range = namelogByName.equal_range( sanitisedName );
+
+	for ( auto it = range.first; it != range.second; ++it )
+	{
+		if ( it->second->slot > -1 )
+		{
+			return it->second;
+		}
+	}
+
+	return nullptr;
+}
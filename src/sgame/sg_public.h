@@ -31,6 +31,7 @@ void              G_UnlaggedClear( gentity_t *ent );
 void              G_UnlaggedCalc( int time, gentity_t *skipEnt );
 void              G_UnlaggedOn( gentity_t *attacker, vec3_t muzzle, float range );
 void              G_UnlaggedOff();
+const float       *G_UnlaggedOrigin( const gentity_t *ent );
 void              ClientThink( int clientNum );
 void              ClientEndFrame( gentity_t *ent );
 void              G_RunClient( gentity_t *ent );
@@ -228,6 +229,16 @@ void              G_LogDestruction( gentity_t *self, gentity_t *actor, int mod )
 void              G_InitDamageLocations();
 void              G_PlayerDie( gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int mod );
 
+// sg_stats.c
+bool              G_StatsStreamActive();
+void              G_StatsStreamInit();
+void              G_StatsStreamFrame();
+void              G_StatsStreamShutdown();
+void              G_StatsKill( gentity_t *self, gentity_t *attacker, int mod, int assistant, team_t assistantTeam );
+void              G_StatsBuild( gentity_t *builder, gentity_t *built );
+void              G_StatsDestroy( gentity_t *self, gentity_t *actor, int mod, buildFate_t fate );
+void              G_StatsTeam( team_t team, int numClients, int freeBudget, int buildableValue, int averageCredits, int averageValue );
+
 // sg_momentum.c
 void              G_DecreaseMomentum();
 float             G_AddMomentumGeneric( team_t team, float amount );
@@ -253,6 +264,7 @@ void              BeginIntermission();
 void              MoveClientToIntermission( gentity_t *client );
 void              G_MapConfigs( const char *mapname );
 void              CalculateRanks();
+void              CalculateClientRank( int clientNum );
 void              FindIntermissionPoint();
 void              G_RunThink( gentity_t *ent );
 void              G_AdminMessage( gentity_t *ent, const char *string );
@@ -269,6 +281,7 @@ void              G_ShutdownGame( int restart );
 vmCvar_t          *G_FindCvar( const char *name );
 void              G_CheckPmoveParamChanges();
 void              G_SendClientPmoveParams(int client);
+void              G_MarkNetCodeDirty( gentity_t *ent );
 void              G_PrepareEntityNetCode();
 
 // sg_maprotation.c
@@ -294,6 +307,9 @@ void              G_namelog_restore( gclient_t *client );
 void              G_namelog_update_score( gclient_t *client );
 void              G_namelog_update_name( gclient_t *client );
 void              G_namelog_cleanup();
+namelog_t         *G_namelog_find_id( int id );
+namelog_t         *G_namelog_find_address( const addr_t *ip );
+namelog_t         *G_namelog_find_current_name( const char *sanitisedName );
 
 // sg_physcis.c
 void              G_Physics( gentity_t *ent, int msec );
@@ -316,6 +332,7 @@ team_t            G_Team( gentity_t *ent );
 bool          G_OnSameTeam( gentity_t *ent1, gentity_t *ent2 );
 void              G_LeaveTeam( gentity_t *self );
 void              G_ChangeTeam( gentity_t *ent, team_t newTeam );
+void              G_InitLocationLookup();
 gentity_t         *GetCloseLocationEntity( gentity_t *ent );
 void              TeamplayInfoMessage( gentity_t *ent );
 void              CheckTeamStatus();
@@ -324,6 +341,7 @@ void              G_UpdateTeamConfigStrings();
 // sg_utils.c
 bool          G_AddressParse( const char *str, addr_t *addr );
 bool          G_AddressCompare( const addr_t *a, const addr_t *b );
+void              G_ResetConfigstringIndexes();
 int               G_ParticleSystemIndex( const char *name );
 int               G_ShaderIndex( const char *name );
 int               G_ModelIndex( const char *name );
@@ -35,6 +35,187 @@ Maryland 20850 USA.
 #include "sg_local.h"
 #include "sg_spawn.h"
 
+/*
+ * Spawn variable index
+ *
+ * Every distinct key in the entity string is interned once, together with
+ * the entity field it sets. While an entity is parsed its key/value pairs are
+ * indexed by interned key, so looking up a spawn variable costs one hash of
+ * the requested key instead of comparing it against every pair, and numeric
+ * values are parsed at most once per pair.
+ */
+#define MAX_SPAWN_KEYS        1024
+#define MAX_SPAWN_KEY_CHARS   16384
+#define SPAWN_KEY_HASH_SIZE   2048 // power of two, larger than MAX_SPAWN_KEYS
+
+enum
+{
+	SPAWNVAR_INT     = 1 << 0,
+	SPAWNVAR_FLOAT   = 1 << 1,
+	SPAWNVAR_VECTOR  = 1 << 2,
+	SPAWNVAR_VECTOR4 = 1 << 3,
+	SPAWNVAR_BOOLEAN = 1 << 4
+};
+
+typedef struct
+{
+	const char *name;
+	int        field; // index into fields, or -1
+	int        var;   // first pair of the current entity with this key, if stamp is current
+	int        stamp;
+} spawnKey_t;
+
+typedef struct
+{
+	int    key; // index into spawnKeys, or -1 if the key could not be interned
+	int    parsed;
+	int    intValue;
+	float  floatValue;
+	int    boolValue; // -1 if neither a boolean nor 0/1
+	vec4_t vector;
+	int    vectorComponents;
+	vec4_t vector4;
+	int    vector4Components;
+} spawnVarInfo_t;
+
+static struct
+{
+	spawnKey_t keys[ MAX_SPAWN_KEYS ];
+	int        numKeys;
+	int        hash[ SPAWN_KEY_HASH_SIZE ]; // index into keys + 1, 0 if free
+	char       chars[ MAX_SPAWN_KEY_CHARS ];
+	int        numChars;
+	bool       overflow; // some key could not be interned, lookups have to fall back to scanning
+
+	spawnVarInfo_t vars[ MAX_SPAWN_VARS ];
+	int            stamp;
+} spawnIndex;
+
+static int G_FieldIndex( const char *key );
+
+static unsigned G_SpawnKeyHash( const char *key )
+{
+	unsigned hash = 2166136261u;
+
+	for ( ; *key; key++ )
+	{
+		hash = ( hash ^ ( unsigned char ) tolower( *key ) ) * 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+===============
+G_SpawnKey
+
+Returns the interned index of a key, interning it if asked to.
+Returns -1 if the key is unknown or there is no room left.
+===============
+*/
+static int G_SpawnKey( const char *key, bool intern )
+{
+	unsigned slot = G_SpawnKeyHash( key ) & ( SPAWN_KEY_HASH_SIZE - 1 );
+
+	while ( spawnIndex.hash[ slot ] )
+	{
+		int index = spawnIndex.hash[ slot ] - 1;
+
+		if ( !Q_stricmp( spawnIndex.keys[ index ].name, key ) )
+		{
+			return index;
+		}
+
+		slot = ( slot + 1 ) & ( SPAWN_KEY_HASH_SIZE - 1 );
+	}
+
+	if ( !intern )
+	{
+		return -1;
+	}
+
+	int length = strlen( key ) + 1;
+
+	if ( spawnIndex.numKeys == MAX_SPAWN_KEYS || spawnIndex.numChars + length > MAX_SPAWN_KEY_CHARS )
+	{
+		spawnIndex.overflow = true;
+		return -1;
+	}
+
+	spawnKey_t *spawnKey = &spawnIndex.keys[ spawnIndex.numKeys ];
+
+	spawnKey->name = spawnIndex.chars + spawnIndex.numChars;
+	memcpy( spawnIndex.chars + spawnIndex.numChars, key, length );
+	spawnIndex.numChars += length;
+
+	spawnKey->field = G_FieldIndex( key );
+	spawnKey->stamp = 0;
+
+	spawnIndex.hash[ slot ] = ++spawnIndex.numKeys;
+
+	return spawnIndex.numKeys - 1;
+}
+
+/*
+===============
+G_SpawnVarIndex
+
+Returns the index of the first pair of the current entity with the given key,
+or -1 if there is none.
+===============
+*/
+static int G_SpawnVarIndex( const char *key )
+{
+	int index = G_SpawnKey( key, false );
+
+	if ( index >= 0 )
+	{
+		const spawnKey_t *spawnKey = &spawnIndex.keys[ index ];
+
+		return spawnKey->stamp == spawnIndex.stamp ? spawnKey->var : -1;
+	}
+
+	if ( spawnIndex.overflow )
+	{
+		for ( int i = 0; i < level.numSpawnVars; i++ )
+		{
+			if ( !Q_stricmp( key, level.spawnVars[ i ][ 0 ] ) )
+			{
+				return i;
+			}
+		}
+	}
+
+	return -1;
+}
+
+/*
+===============
+G_IndexSpawnVar
+
+Adds the pair that was just parsed to the index of the current entity.
+===============
+*/
+static void G_IndexSpawnVar( int var )
+{
+	spawnVarInfo_t *info = &spawnIndex.vars[ var ];
+
+	info->key = G_SpawnKey( level.spawnVars[ var ][ 0 ], true );
+	info->parsed = 0;
+
+	if ( info->key >= 0 )
+	{
+		spawnKey_t *spawnKey = &spawnIndex.keys[ info->key ];
+
+		// like a scan, a lookup finds the first pair with a key
+		if ( spawnKey->stamp != spawnIndex.stamp )
+		{
+			spawnKey->stamp = spawnIndex.stamp;
+			spawnKey->var = var;
+		}
+	}
+}
+
 bool G_SpawnString( const char *key, const char *defaultString, char **out )
 {
 	int i;
@@ -46,19 +227,40 @@ bool G_SpawnString( const char *key, const char *defaultString, char **out )
 		return false;
 	}
 
-	for ( i = 0; i < level.numSpawnVars; i++ )
+	i = G_SpawnVarIndex( key );
+
+	if ( i >= 0 )
 	{
-		if ( !Q_stricmp( key, level.spawnVars[ i ][ 0 ] ) )
-		{
-			*out = level.spawnVars[ i ][ 1 ];
-			return true;
-		}
+		*out = level.spawnVars[ i ][ 1 ];
+		return true;
 	}
 
 	*out = ( char * ) defaultString;
 	return false;
 }
 
+/*
+===============
+G_SpawnVarInfo
+
+Like G_SpawnString, but also returns the parse cache of the pair,
+or nullptr if the default is used.
+===============
+*/
+static spawnVarInfo_t *G_SpawnVarInfo( const char *key, const char *defaultString, char **out )
+{
+	int i;
+
+	if ( !level.spawning || ( i = G_SpawnVarIndex( key ) ) < 0 )
+	{
+		*out = ( char * ) defaultString;
+		return nullptr;
+	}
+
+	*out = level.spawnVars[ i ][ 1 ];
+	return &spawnIndex.vars[ i ];
+}
+
 /**
  * spawns a string and sets it as a cvar.
  *
@@ -85,82 +287,141 @@ static void G_SpawnStringIntoCVar( const char *key, const char *cvarName )
 	trap_Cvar_Set( cvarName, tmpString );
 }
 
-bool G_SpawnBoolean( const char *key, bool defaultqboolean )
+/**
+ * @return 1 or 0 for a boolean value, -1 if the string is none
+ */
+static int G_ParseBoolean( const char *string )
 {
-	char     *string;
-	int     out;
+	int out;
 
-	if(G_SpawnString( key, "", &string ))
+	if ( Q_strtoi( string, &out ) )
 	{
-		if(Q_strtoi(string, &out))
-		{
-			if(out == 1)
-			{
-				return true;
-			}
-			else if(out == 0)
-			{
-				return false;
-			}
-			return defaultqboolean;
-		}
-		else
-		{
-			if(!Q_stricmp(string, "true"))
-			{
-				return true;
-			}
-			else if(!Q_stricmp(string, "false"))
-			{
-				return false;
-			}
-			return defaultqboolean;
-		}
+		return ( out == 0 || out == 1 ) ? out : -1;
+	}
+
+	if ( !Q_stricmp( string, "true" ) )
+	{
+		return 1;
 	}
-	else
+	else if ( !Q_stricmp( string, "false" ) )
+	{
+		return 0;
+	}
+
+	return -1;
+}
+
+bool G_SpawnBoolean( const char *key, bool defaultqboolean )
+{
+	char           *string;
+	spawnVarInfo_t *info = G_SpawnVarInfo( key, "", &string );
+
+	if ( !info )
 	{
 		return defaultqboolean;
 	}
+
+	if ( !( info->parsed & SPAWNVAR_BOOLEAN ) )
+	{
+		info->boolValue = G_ParseBoolean( string );
+		info->parsed |= SPAWNVAR_BOOLEAN;
+	}
+
+	return info->boolValue < 0 ? defaultqboolean : info->boolValue;
 }
 
 bool  G_SpawnFloat( const char *key, const char *defaultString, float *out )
 {
-	char     *s;
-	bool present;
+	char           *s;
+	spawnVarInfo_t *info = G_SpawnVarInfo( key, defaultString, &s );
+
+	if ( !info )
+	{
+		*out = atof( s );
+		return false;
+	}
+
+	if ( !( info->parsed & SPAWNVAR_FLOAT ) )
+	{
+		info->floatValue = atof( s );
+		info->parsed |= SPAWNVAR_FLOAT;
+	}
 
-	present = G_SpawnString( key, defaultString, &s );
-	*out = atof( s );
-	return present;
+	*out = info->floatValue;
+	return true;
 }
 
 bool G_SpawnInt( const char *key, const char *defaultString, int *out )
 {
-	char     *s;
-	bool present;
+	char           *s;
+	spawnVarInfo_t *info = G_SpawnVarInfo( key, defaultString, &s );
 
-	present = G_SpawnString( key, defaultString, &s );
-	*out = atoi( s );
-	return present;
+	if ( !info )
+	{
+		*out = atoi( s );
+		return false;
+	}
+
+	if ( !( info->parsed & SPAWNVAR_INT ) )
+	{
+		info->intValue = atoi( s );
+		info->parsed |= SPAWNVAR_INT;
+	}
+
+	*out = info->intValue;
+	return true;
 }
 
 bool  G_SpawnVector( const char *key, const char *defaultString, float *out )
 {
-	char     *s;
-	bool present;
+	char           *s;
+	spawnVarInfo_t *info = G_SpawnVarInfo( key, defaultString, &s );
 
-	present = G_SpawnString( key, defaultString, &s );
-	sscanf( s, "%f %f %f", &out[ 0 ], &out[ 1 ], &out[ 2 ] );
-	return present;
+	if ( !info )
+	{
+		sscanf( s, "%f %f %f", &out[ 0 ], &out[ 1 ], &out[ 2 ] );
+		return false;
+	}
+
+	if ( !( info->parsed & SPAWNVAR_VECTOR ) )
+	{
+		info->vectorComponents = std::max( 0, sscanf( s, "%f %f %f", &info->vector[ 0 ], &info->vector[ 1 ], &info->vector[ 2 ] ) );
+		info->parsed |= SPAWNVAR_VECTOR;
+	}
+
+	// components that could not be parsed keep their value, as with sscanf
+	for ( int i = 0; i < info->vectorComponents; i++ )
+	{
+		out[ i ] = info->vector[ i ];
+	}
+
+	return true;
 }
 
 bool  G_SpawnVector4( const char *key, const char *defaultString, float *out )
 {
-	char     *s;
-	bool present;
+	char           *s;
+	spawnVarInfo_t *info = G_SpawnVarInfo( key, defaultString, &s );
+
+	if ( !info )
+	{
+		sscanf( s, "%f %f %f %f", &out[ 0 ], &out[ 1 ], &out[ 2 ], &out[ 3 ] );
+		return false;
+	}
+
+	if ( !( info->parsed & SPAWNVAR_VECTOR4 ) )
+	{
+		info->vector4Components = std::max( 0, sscanf( s, "%f %f %f %f", &info->vector4[ 0 ], &info->vector4[ 1 ],
+		                                                &info->vector4[ 2 ], &info->vector4[ 3 ] ) );
+		info->parsed |= SPAWNVAR_VECTOR4;
+	}
 
-	present = G_SpawnString( key, defaultString, &s );
-	sscanf( s, "%f %f %f %f", &out[ 0 ], &out[ 1 ], &out[ 2 ], &out[ 3 ] );
-	return present;
+	for ( int i = 0; i < info->vector4Components; i++ )
+	{
+		out[ i ] = info->vector4[ i ];
+	}
+
+	return true;
 }
 
 //
@@ -244,6 +505,13 @@ static const fieldDescriptor_t fields[] =
 	{ "yaw",                 FOFS( s.angles ),            F_YAW       ,ENT_V_UNCLEAR, nullptr },
 };
 
+static int G_FieldIndex( const char *key )
+{
+	const fieldDescriptor_t *fieldDescriptor = (const fieldDescriptor_t*) bsearch( key, fields, ARRAY_LEN( fields ), sizeof( fieldDescriptor_t ), cmdcmp );
+
+	return fieldDescriptor ? (int) ( fieldDescriptor - fields ) : -1;
+}
+
 typedef enum
 {
 	/*
@@ -700,20 +968,12 @@ Takes a key/value pair and sets the binary values
 in a gentity
 ===============
 */
-void G_ParseField( const char *key, const char *rawString, gentity_t *entity )
+static void G_ParseFieldWithDescriptor( const fieldDescriptor_t *fieldDescriptor, const char *key, const char *rawString, gentity_t *entity )
 {
-	fieldDescriptor_t *fieldDescriptor;
 	byte    *entityDataField;
 	vec4_t  tmpFloatData;
 	variatingTime_t varTime = {0, 0};
 
-	fieldDescriptor = (fieldDescriptor_t*) bsearch( key, fields, ARRAY_LEN( fields ), sizeof( fieldDescriptor_t ), cmdcmp );
-
-	if ( !fieldDescriptor )
-	{
-		return;
-	}
-
 	entityDataField = ( byte * ) entity + fieldDescriptor->offset;
 
 	switch ( fieldDescriptor->type )
@@ -790,6 +1050,16 @@ void G_ParseField( const char *key, const char *rawString, gentity_t *entity )
 		G_WarnAboutDeprecatedEntityField(entity, fieldDescriptor->replacement, key, fieldDescriptor->versionState );
 }
 
+void G_ParseField( const char *key, const char *rawString, gentity_t *entity )
+{
+	int field = G_FieldIndex( key );
+
+	if ( field >= 0 )
+	{
+		G_ParseFieldWithDescriptor( &fields[ field ], key, rawString, entity );
+	}
+}
+
 /*
 ===================
 G_SpawnGEntityFromSpawnVars
@@ -808,7 +1078,17 @@ void G_SpawnGEntityFromSpawnVars()
 
 	for ( i = 0; i < level.numSpawnVars; i++ )
 	{
-		G_ParseField( level.spawnVars[ i ][ 0 ], level.spawnVars[ i ][ 1 ], spawningEntity );
+		int key = spawnIndex.vars[ i ].key;
+
+		if ( key < 0 )
+		{
+			G_ParseField( level.spawnVars[ i ][ 0 ], level.spawnVars[ i ][ 1 ], spawningEntity );
+		}
+		else if ( spawnIndex.keys[ key ].field >= 0 )
+		{
+			G_ParseFieldWithDescriptor( &fields[ spawnIndex.keys[ key ].field ],
+			                            level.spawnVars[ i ][ 0 ], level.spawnVars[ i ][ 1 ], spawningEntity );
+		}
 	}
 
 	if(G_SpawnBoolean( "nop", false ) || G_SpawnBoolean( "notunv", false ))
@@ -955,6 +1235,7 @@ bool G_ParseSpawnVars()
 
 	level.numSpawnVars = 0;
 	level.numSpawnVarChars = 0;
+	spawnIndex.stamp++;
 
 	// parse the opening brace
 	if ( !trap_GetEntityToken( com_token, sizeof( com_token ) ) )
@@ -1000,6 +1281,7 @@ bool G_ParseSpawnVars()
 
 		level.spawnVars[ level.numSpawnVars ][ 0 ] = G_AddSpawnVarToken( keyname );
 		level.spawnVars[ level.numSpawnVars ][ 1 ] = G_AddSpawnVarToken( com_token );
+		G_IndexSpawnVar( level.numSpawnVars );
 		level.numSpawnVars++;
 	}
 
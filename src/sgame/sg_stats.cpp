@@ -0,0 +1,359 @@
+/*
+===========================================================================
+
+Copyright (C) 2026 Unvanquished Developers
+
+This file is part of Unvanquished.
+
+Unvanquished is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Unvanquished is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Unvanquished. If not, see <http://www.gnu.org/licenses/>.
+
+===========================================================================
+*/
+
+// sg_stats.cpp -- binary gameplay statistics stream, see sg_stats.h for the layout
+
+#include "sg_local.h"
+#include "sg_stats.h"
+
+static Cvar::Cvar<bool> g_statsStream("g_statsStream", "write a binary gameplay statistics stream to stats/gameplay/", Cvar::NONE, false);
+
+#define STATS_BUFFER_SIZE     16384
+#define STATS_FLUSH_SIZE      4096 // write out once this much is pending...
+#define STATS_FLUSH_INTERVAL  1000 // ...or this many ms have passed
+
+static struct
+{
+	byte data[ STATS_BUFFER_SIZE ];
+	int  used;
+	int  lastFlush;
+	int  dropped;
+} statsBuffer;
+
+/**
+ * @brief Assembles a single record on the stack before it is committed to the stream buffer.
+ */
+class StatsRecord
+{
+public:
+	StatsRecord( statsRecordType_t type ) : size( STATS_RECORD_HEADER_SIZE )
+	{
+		data[ 0 ] = ( byte ) type;
+		Store( 2, level.matchTime, 4 );
+	}
+
+	StatsRecord &Int8( int value )   { return Append( value, 1 ); }
+	StatsRecord &Int16( int value )  { return Append( value, 2 ); }
+	StatsRecord &Int32( int value )  { return Append( value, 4 ); }
+
+	StatsRecord &Float( float value )
+	{
+		int32_t bits;
+		memcpy( &bits, &value, sizeof( bits ) );
+		return Append( bits, 4 );
+	}
+
+	StatsRecord &String( const char *value )
+	{
+		// truncate so that a few strings always fit into one record
+		int len = std::min( ( int ) strlen( value ), 63 );
+
+		Int8( len );
+		memcpy( data + size, value, len );
+		size += len;
+		return *this;
+	}
+
+	/**
+	 * @brief Appends the record to the stream buffer, or counts it as dropped if there is no room.
+	 */
+	void Commit()
+	{
+		data[ 1 ] = ( byte )( size - STATS_RECORD_HEADER_SIZE );
+
+		if ( statsBuffer.used + size > STATS_BUFFER_SIZE )
+		{
+			statsBuffer.dropped++;
+			return;
+		}
+
+		memcpy( statsBuffer.data + statsBuffer.used, data, size );
+		statsBuffer.used += size;
+	}
+
+private:
+	void Store( int offset, int value, int bytes )
+	{
+		for ( int i = 0; i < bytes; i++ )
+		{
+			data[ offset + i ] = ( byte )( ( unsigned ) value >> ( 8 * i ) );
+		}
+	}
+
+	StatsRecord &Append( int value, int bytes )
+	{
+		Store( size, value, bytes );
+		size += bytes;
+		return *this;
+	}
+
+	byte data[ STATS_RECORD_HEADER_SIZE + STATS_RECORD_MAX_PAYLOAD ];
+	int  size;
+};
+
+static int StatsEntityNum( const gentity_t *ent )
+{
+	return ent ? ent->s.number : ENTITYNUM_WORLD;
+}
+
+static team_t StatsTeam( const gentity_t *ent )
+{
+	return ( ent && ent->client ) ? ( team_t ) ent->client->pers.team : TEAM_NONE;
+}
+
+/*
+=================
+G_StatsStreamActive
+=================
+*/
+bool G_StatsStreamActive()
+{
+	return level.statsStreamFile != 0;
+}
+
+/*
+=================
+G_StatsStreamInit
+
+Opens the stream if g_statsStream is set and writes the file header.
+=================
+*/
+void G_StatsStreamInit()
+{
+	char     filename[ 128 ], mapname[ 64 ];
+	byte     header[ STATS_HEADER_SIZE ];
+	qtime_t  qt;
+
+	statsBuffer.used = 0;
+	statsBuffer.dropped = 0;
+	statsBuffer.lastFlush = level.time;
+
+	if ( !g_statsStream.Get() )
+	{
+		return;
+	}
+
+	Com_GMTime( &qt );
+	trap_Cvar_VariableStringBuffer( "mapname", mapname, sizeof( mapname ) );
+
+	Com_sprintf( filename, sizeof( filename ),
+	             "stats/gameplay/%04i%02i%02i_%02i%02i%02i_%s.stats",
+	             1900 + qt.tm_year, qt.tm_mon + 1, qt.tm_mday,
+	             qt.tm_hour, qt.tm_min, qt.tm_sec,
+	             mapname );
+
+	trap_FS_FOpenFile( filename, &level.statsStreamFile, fsMode_t::FS_WRITE );
+
+	if ( !level.statsStreamFile )
+	{
+		Log::Warn( "Couldn't open gameplay statistics stream: %s", filename );
+		return;
+	}
+
+	memcpy( header, STATS_STREAM_MAGIC, STATS_STREAM_MAGIC_LEN );
+	header[ STATS_STREAM_MAGIC_LEN + 0 ] = STATS_STREAM_VERSION & 0xff;
+	header[ STATS_STREAM_MAGIC_LEN + 1 ] = STATS_STREAM_VERSION >> 8;
+	header[ STATS_STREAM_MAGIC_LEN + 2 ] = 0;
+	header[ STATS_STREAM_MAGIC_LEN + 3 ] = 0;
+	trap_FS_Write( header, sizeof( header ), level.statsStreamFile );
+
+	StatsRecord( STATS_MATCH_START )
+		.String( Q3_VERSION )
+		.String( mapname )
+		.Int32( g_buildPointInitialBudget.integer )
+		.Int32( g_buildPointBudgetPerMiner.integer )
+		.Int32( g_momentumHalfLife.integer )
+		.Commit();
+}
+
+/*
+=================
+G_StatsStreamFlush
+=================
+*/
+static void G_StatsStreamFlush()
+{
+	if ( statsBuffer.dropped )
+	{
+		int dropped = statsBuffer.dropped;
+
+		// make sure the gap is recorded even if the buffer was full
+		trap_FS_Write( statsBuffer.data, statsBuffer.used, level.statsStreamFile );
+		statsBuffer.used = 0;
+		statsBuffer.dropped = 0;
+
+		StatsRecord( STATS_DROPPED ).Int32( dropped ).Commit();
+		Log::Warn( "Gameplay statistics stream overflow, %d records dropped", dropped );
+	}
+
+	if ( statsBuffer.used )
+	{
+		trap_FS_Write( statsBuffer.data, statsBuffer.used, level.statsStreamFile );
+		statsBuffer.used = 0;
+	}
+
+	statsBuffer.lastFlush = level.time;
+}
+
+/*
+=================
+G_StatsStreamFrame
+
+Writes pending records once enough accumulated, so the cost per frame is at
+most one write of STATS_BUFFER_SIZE bytes.
+=================
+*/
+void G_StatsStreamFrame()
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	if ( statsBuffer.used < STATS_FLUSH_SIZE && !statsBuffer.dropped &&
+	     level.time - statsBuffer.lastFlush < STATS_FLUSH_INTERVAL )
+	{
+		return;
+	}
+
+	G_StatsStreamFlush();
+}
+
+/*
+=================
+G_StatsStreamShutdown
+=================
+*/
+void G_StatsStreamShutdown()
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	StatsRecord( STATS_MATCH_END )
+		.Int8( level.lastWin )
+		.Int32( level.matchTime )
+		.Commit();
+
+	G_StatsStreamFlush();
+
+	trap_FS_FCloseFile( level.statsStreamFile );
+	level.statsStreamFile = 0;
+}
+
+/*
+=================
+G_StatsKill
+=================
+*/
+void G_StatsKill( gentity_t *self, gentity_t *attacker, int mod, int assistant, team_t assistantTeam )
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	StatsRecord( STATS_KILL )
+		.Int16( StatsEntityNum( attacker ) )
+		.Int16( self->s.number )
+		.Int8( StatsTeam( attacker ) )
+		.Int8( StatsTeam( self ) )
+		.Int8( self->client->ps.stats[ STAT_CLASS ] )
+		.Int8( mod )
+		.Int16( assistant )
+		.Int8( assistantTeam )
+		.Commit();
+}
+
+/*
+=================
+G_StatsBuild
+=================
+*/
+void G_StatsBuild( gentity_t *builder, gentity_t *built )
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	StatsRecord( STATS_BUILD )
+		.Int16( StatsEntityNum( builder ) )
+		.Int16( built->s.number )
+		.Int8( built->buildableTeam )
+		.Int8( built->s.modelindex )
+		.Int32( ( int ) built->s.origin[ 0 ] )
+		.Int32( ( int ) built->s.origin[ 1 ] )
+		.Int32( ( int ) built->s.origin[ 2 ] )
+		.Commit();
+}
+
+/*
+=================
+G_StatsDestroy
+=================
+*/
+void G_StatsDestroy( gentity_t *self, gentity_t *actor, int mod, buildFate_t fate )
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	StatsRecord( STATS_DESTROY )
+		.Int16( StatsEntityNum( actor ) )
+		.Int16( self->s.number )
+		.Int8( self->buildableTeam )
+		.Int8( self->s.modelindex )
+		.Int8( mod )
+		.Int8( fate )
+		.Commit();
+}
+
+/*
+=================
+G_StatsTeam
+
+Periodic team state, sampled together with the text gameplay statistics.
+=================
+*/
+void G_StatsTeam( team_t team, int numClients, int freeBudget, int buildableValue,
+                  int averageCredits, int averageValue )
+{
+	if ( !level.statsStreamFile )
+	{
+		return;
+	}
+
+	StatsRecord( STATS_TEAM )
+		.Int8( team )
+		.Int8( numClients )
+		.Float( level.team[ team ].momentum )
+		.Float( level.team[ team ].totalBudget )
+		.Int32( freeBudget )
+		.Int32( buildableValue )
+		.Int32( averageCredits )
+		.Int32( averageValue )
+		.Commit();
+}
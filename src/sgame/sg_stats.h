@@ -0,0 +1,70 @@
+/*
+===========================================================================
+
+Copyright (C) 2026 Unvanquished Developers
+
+This file is part of Unvanquished.
+
+Unvanquished is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Unvanquished is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Unvanquished. If not, see <http://www.gnu.org/licenses/>.
+
+===========================================================================
+*/
+
+// sg_stats.h -- layout of the binary gameplay statistics stream
+//
+// This header is shared with the stats reader tool and must not depend on
+// anything but the C standard library.
+//
+// A stream starts with a file header and is followed by records. All values
+// are little endian. Every record starts with
+//
+//   uint8  type      one of statsRecordType_t
+//   uint8  length    number of payload bytes that follow the time
+//   int32  time      match time in milliseconds
+//
+// Readers must skip records of unknown type using the length, so new record
+// types can be added without bumping STATS_STREAM_VERSION. Changing the
+// payload of an existing record type requires a version bump.
+
+#ifndef SG_STATS_H_
+#define SG_STATS_H_
+
+#include <stdint.h>
+
+#define STATS_STREAM_MAGIC        "UVGS"
+#define STATS_STREAM_MAGIC_LEN    4
+#define STATS_STREAM_VERSION      1
+
+#define STATS_HEADER_SIZE         ( STATS_STREAM_MAGIC_LEN + 2 + 2 ) // magic, version, reserved
+#define STATS_RECORD_HEADER_SIZE  6
+#define STATS_RECORD_MAX_PAYLOAD  255
+
+enum statsRecordType_t
+{
+	STATS_MATCH_START = 1, // str version, str map, int32 initialBudget, int32 budgetPerMiner, int32 momentumHalfLife
+	STATS_MATCH_END,       // uint8 winner, int32 duration
+	STATS_KILL,            // int16 killer, int16 victim, uint8 killerTeam, uint8 victimTeam, uint8 victimClass,
+	                       // uint8 meansOfDeath, int16 assistant, uint8 assistantTeam
+	STATS_BUILD,           // int16 builder, int16 buildable, uint8 team, uint8 type, int32 x, int32 y, int32 z
+	STATS_DESTROY,         // int16 actor, int16 buildable, uint8 team, uint8 type, uint8 meansOfDeath, uint8 fate
+	STATS_TEAM,            // uint8 team, uint8 clients, float momentum, float totalBudget, int32 freeBudget,
+	                       // int32 buildableValue, int32 averageCredits, int32 averageValue
+	STATS_DROPPED,         // int32 records lost to buffer overflow since the last STATS_DROPPED
+
+	STATS_NUM_RECORD_TYPES
+};
+
+// strings are stored as uint8 length followed by the bytes, without terminator
+
+#endif // SG_STATS_H_
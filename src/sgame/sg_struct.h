@@ -106,6 +106,7 @@ struct gentity_s
 
 	bool     inuse;
 	bool     neverFree; // if true, FreeEntity will only unlink
+	bool     netCodeQueued; // in level.netCodeQueue, see G_MarkNetCodeDirty
 	int          freetime; // level.time when the object was freed
 	int          eventTime; // events will be cleared EVENT_VALID_MSEC after set
 	bool     freeAfterEvent;
@@ -414,10 +415,12 @@ struct namelog_s
 	struct namelog_s *next;
 
 	char             name[ MAX_NAMELOG_NAMES ][ MAX_NAME_LENGTH ];
+	char             sanitisedName[ MAX_NAMELOG_NAMES ][ MAX_NAME_LENGTH ]; // for searches
 	addr_t           ip[ MAX_NAMELOG_ADDRS ];
 	char             guid[ 33 ];
 	int              slot;
 	bool         banned;
+	int              lastSeen; // level.time of the last connect or disconnect
 
 	int              nameOffset;
 	int              nameChangeTime;
@@ -436,6 +439,31 @@ struct namelog_s
 	int              id;
 };
 
+/**
+ * a scoreboard row as last sent to a client, see ScoreboardMessage
+ */
+struct scoreboardRow_s
+{
+	int score;
+	int ping;
+	int time;
+	int weapon;
+	int upgrade;
+};
+
+/**
+ * a teammate's overlay info, see TeamplayInfoMessage
+ */
+struct teamInfo_s
+{
+	int enterTime; // tells apart clients that reused the slot
+	int location;
+	int health;
+	int curWeaponClass;
+	int credit;
+	int upgrade;
+};
+
 /**
  * client data that stays across multiple respawns, but is cleared
  * on each level change or team change at ClientBegin()
@@ -485,12 +513,21 @@ struct clientPersistant_s
 	int      pubkey_authenticated; // -1 = does not have pubkey, 0 = not authenticated, 1 = authenticated
 	int      pubkey_challengedAt; // time at which challenge was sent
 
-	// level.time when teamoverlay info changed so we know to tell other players.
-	int                 infoChangeTime;
+	// teamoverlay info as last sent to this client, for the team it was sent for
+	int                 teamInfoTeam;
+	bool                teamInfoSent[ MAX_CLIENTS ];
+	teamInfo_t          teamInfoLast[ MAX_CLIENTS ];
 
 	// warnings in the ban log
 	bool            hasWarnings;
 
+	// the scoreboard this client was last sent, so only changes need be sent
+	int              scoreboardSeq; // 0 if the client has no scoreboard to apply changes to
+	int              scoreboardKills[ 2 ];
+	int              scoreboardNumRows;
+	int              scoreboardOrder[ MAX_CLIENTS ];
+	scoreboardRow_t  scoreboardRows[ MAX_CLIENTS ]; // by client number
+
 	bool isFillerBot;
 };
 
@@ -503,6 +540,25 @@ struct unlagged_s
 };
 
 #define MAX_UNLAGGED_MARKERS 256
+
+// component offsets into unlaggedFrame_t::box
+#define UNLAGGED_ORIGIN     0
+#define UNLAGGED_MINS       3
+#define UNLAGGED_MAXS       6
+#define UNLAGGED_COMPONENTS 9
+
+/**
+ * one server frame of lag compensation history
+ *
+ * Stored as structure-of-arrays: each bounding box component holds one value
+ * per client slot, so rewinding all clients is a single flat lerp.
+ */
+struct unlaggedFrame_s
+{
+	float box[ UNLAGGED_COMPONENTS ][ MAX_CLIENTS ];
+	bool  used[ MAX_CLIENTS ];
+};
+
 #define MAX_TRAMPLE_BUILDABLES_TRACKED 20
 
 /**
@@ -567,10 +623,10 @@ struct gclient_s
 	int        lastAmmoRefillTime;
 	int        lastFuelRefillTime;
 
-	unlagged_t unlaggedHist[ MAX_UNLAGGED_MARKERS ];
 	unlagged_t unlaggedBackup;
 	unlagged_t unlaggedCalc;
 	int        unlaggedTime;
+	bool       unlaggedRewound; // traces clip against unlaggedCalc instead of the linked box
 
 	float      voiceEnthusiasm;
 	char       lastVoiceCmd[ MAX_VOICE_CMD_LEN ];
@@ -634,11 +690,17 @@ struct level_locals_s
 	int              gentitySize;
 	int              num_entities; // MAX_CLIENTS <= num_entities <= ENTITYNUM_MAX_NORMAL
 
+	// non-client entities whose network state needs to be prepared this frame
+	int              netCodeQueue[ MAX_GENTITIES ];
+	int              numNetCodeQueued;
+	bool             netCodeQueueOverflowed; // prepare everything once
+
 	int              warmupTime; // restart match at this time
 	int              timelimit; //time in minutes
 
 	fileHandle_t     logFile;
 	fileHandle_t     logGameplayFile;
+	fileHandle_t     statsStreamFile;
 
 	// store latched cvars here that we want to get at often
 	int      maxclients;
@@ -705,6 +767,9 @@ struct level_locals_s
 
 	int              unlaggedIndex;
 	int              unlaggedTimes[ MAX_UNLAGGED_MARKERS ];
+	unlaggedFrame_t  unlaggedFrames[ MAX_UNLAGGED_MARKERS ];
+	int              numUnlaggedRewound;
+	int              unlaggedRewound[ MAX_CLIENTS ]; // clients with unlaggedRewound set
 
 	char             layout[ MAX_QPATH ];
 
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
 #include "sg_local.h"
+#include "sg_cm_world.h"
 #include "CBSE.h"
 
 /*
@@ -324,6 +325,55 @@ void G_ChangeTeam( gentity_t *ent, team_t newTeam )
 	TeamplayInfoMessage( ent );
 }
 
+// Locations that may be in the PVS of each cluster, see G_InitLocationLookup.
+// The candidates of cluster c are locationCandidates[ locationCandidateStart[ c ] ]
+// up to locationCandidateStart[ c + 1 ].
+static std::vector<int>       locationCandidateStart;
+static std::vector<gentity_t*> locationCandidates;
+
+/*
+==================
+G_InitLocationLookup
+
+Called once all locations are spawned.  Lists for every PVS cluster the
+locations that can possibly be seen from it, so that GetCloseLocationEntity
+does not have to consider every location of the map.
+==================
+*/
+void G_InitLocationLookup()
+{
+	int       cluster, numClusters;
+	gentity_t *eloc;
+	std::vector<std::pair<gentity_t*, int>> locations;
+
+	locationCandidateStart.clear();
+	locationCandidates.clear();
+
+	for ( eloc = level.locationHead; eloc; eloc = eloc->nextPathSegment )
+	{
+		locations.emplace_back( eloc, G_CM_PointCluster( eloc->r.currentOrigin ) );
+	}
+
+	numClusters = G_CM_NumClusters();
+	locationCandidateStart.reserve( numClusters + 1 );
+
+	for ( cluster = 0; cluster < numClusters; cluster++ )
+	{
+		locationCandidateStart.push_back( locationCandidates.size() );
+
+		for ( const auto& location : locations )
+		{
+			// locations outside of any cluster are always candidates
+			if ( G_CM_ClusterInPVS( cluster, location.second ) )
+			{
+				locationCandidates.push_back( location.first );
+			}
+		}
+	}
+
+	locationCandidateStart.push_back( locationCandidates.size() );
+}
+
 /**
  * @todo Move out of sg_team.c as it is not team-specific.
  */
@@ -331,65 +381,184 @@ gentity_t *GetCloseLocationEntity( gentity_t *ent )
 {
 	gentity_t *eloc, *best;
 	float     bestlen, len;
+	int       cluster, first, num, i, nearest;
+	float     lens[ MAX_GENTITIES ];
 
 	best = nullptr;
 	bestlen = 3.0f * 8192.0f * 8192.0f;
 
-	for ( eloc = level.locationHead; eloc; eloc = eloc->nextPathSegment )
+	cluster = G_CM_PointCluster( ent->r.currentOrigin );
+
+	if ( cluster < 0 || cluster + 1 >= (int) locationCandidateStart.size() )
+	{
+		// no lookup for this point, consider every location
+		for ( eloc = level.locationHead; eloc; eloc = eloc->nextPathSegment )
+		{
+			len = DistanceSquared( ent->r.currentOrigin, eloc->r.currentOrigin );
+
+			if ( len > bestlen )
+			{
+				continue;
+			}
+
+			if ( !trap_InPVS( ent->r.currentOrigin, eloc->r.currentOrigin ) )
+			{
+				continue;
+			}
+
+			bestlen = len;
+			best = eloc;
+		}
+
+		return best;
+	}
+
+	first = locationCandidateStart[ cluster ];
+	num = locationCandidateStart[ cluster + 1 ] - first;
+
+	for ( i = 0; i < num; i++ )
 	{
-		len = DistanceSquared( ent->r.currentOrigin, eloc->r.currentOrigin );
+		lens[ i ] = DistanceSquared( ent->r.currentOrigin, locationCandidates[ first + i ]->r.currentOrigin );
+	}
 
-		if ( len > bestlen )
+	// try the candidates nearest first, they already are in the PVS so only
+	// closed doors can reject one, hence this rarely takes more than one check
+	for ( ;; )
+	{
+		nearest = -1;
+
+		for ( i = 0; i < num; i++ )
 		{
-			continue;
+			if ( lens[ i ] <= bestlen && ( nearest < 0 || lens[ i ] < lens[ nearest ] ) )
+			{
+				nearest = i;
+			}
 		}
 
-		if ( !trap_InPVS( ent->r.currentOrigin, eloc->r.currentOrigin ) )
+		if ( nearest < 0 )
 		{
-			continue;
+			return nullptr;
 		}
 
-		bestlen = len;
-		best = eloc;
-	}
+		eloc = locationCandidates[ first + nearest ];
 
-	return best;
+		if ( trap_InPVS( ent->r.currentOrigin, eloc->r.currentOrigin ) )
+		{
+			return eloc;
+		}
+
+		// rejected, don't pick it again
+		lens[ nearest ] = FLT_MAX;
+	}
 }
 
 /*---------------------------------------------------------------------------*/
 
+/*
+==================
+G_TeamInfo
+
+Current overlay info of a client, computed at most once per frame.
+==================
+*/
+static const teamInfo_t *G_TeamInfo( gentity_t *player )
+{
+	static teamInfo_t infos[ MAX_CLIENTS ];
+	static int        infoTimes[ MAX_CLIENTS ];
+	static bool       infoValid[ MAX_CLIENTS ];
+	gclient_t         *cl = player->client;
+	teamInfo_t        *info = &infos[ player->s.number ];
+
+	if ( infoValid[ player->s.number ] && infoTimes[ player->s.number ] == level.time &&
+	     info->enterTime == cl->pers.enterTime )
+	{
+		return info;
+	}
+
+	infoValid[ player->s.number ] = true;
+	infoTimes[ player->s.number ] = level.time;
+	info->enterTime = cl->pers.enterTime;
+	info->location = cl->pers.location;
+	info->credit = cl->pers.credit;
+	info->curWeaponClass = WP_NONE;
+	info->upgrade = UP_NONE;
+	info->health = 0;
+
+	if ( cl->sess.spectatorState != SPECTATOR_NOT )
+	{
+		return info;
+	}
+
+	if ( cl->pers.team == TEAM_HUMANS )
+	{
+		info->curWeaponClass = cl->ps.weapon;
+
+		if ( BG_InventoryContainsUpgrade( UP_BATTLESUIT, cl->ps.stats ) )
+		{
+			info->upgrade = UP_BATTLESUIT;
+		}
+		else if ( BG_InventoryContainsUpgrade( UP_JETPACK, cl->ps.stats ) )
+		{
+			info->upgrade = UP_JETPACK;
+		}
+		else if ( BG_InventoryContainsUpgrade( UP_RADAR, cl->ps.stats ) )
+		{
+			info->upgrade = UP_RADAR;
+		}
+		else if ( BG_InventoryContainsUpgrade( UP_LIGHTARMOUR, cl->ps.stats ) )
+		{
+			info->upgrade = UP_LIGHTARMOUR;
+		}
+
+		info->health = static_cast<int>( std::ceil( player->entity->Get<HealthComponent>()->Health() ) );
+	}
+	else if ( cl->pers.team == TEAM_ALIENS )
+	{
+		info->curWeaponClass = cl->ps.stats[ STAT_CLASS ];
+		info->health = static_cast<int>( std::ceil( player->entity->Get<HealthComponent>()->Health() ) );
+	}
+
+	return info;
+}
+
 /*
 ==================
 TeamplayInfoMessage
 
 Format:
-  clientNum location health weapon upgrade
+  clientNum fields [location] [health] [weapon] [credit] [upgrade]
 
+Only the teammates whose info changed since it was last sent to this client
+are listed, with only the TEAMINFO_* fields that changed.  Nothing is sent
+if nothing changed.
 ==================
 */
 void TeamplayInfoMessage( gentity_t *ent )
 {
-	char      entry[ 24 ];
-	char      string[ ( MAX_CLIENTS - 1 ) * ( sizeof( entry ) - 1 ) + 1 ];
-	int       i, j;
-	int       team, stringlength;
-	gentity_t *player;
-	gclient_t *cl;
-	upgrade_t upgrade = UP_NONE;
-	int       curWeaponClass = WP_NONE; // sends weapon for humans, class for aliens
-	int       health = 0;
+	char             entry[ 40 ];
+	char             string[ ( MAX_CLIENTS - 1 ) * ( sizeof( entry ) - 1 ) + 1 ];
+	int              i, j;
+	int              team, stringlength;
+	int              fields;
+	gentity_t        *player;
+	gclient_t        *cl;
+	const teamInfo_t *info;
+	teamInfo_t       *last;
+	clientPersistant_t *pers = &ent->client->pers;
 
 	if ( !g_allowTeamOverlay.integer )
 	{
 		return;
 	}
 
-	if ( !ent->client->pers.teamInfo )
+	if ( !pers->teamInfo )
 	{
+		// resend everything once the overlay is enabled again
+		pers->teamInfoTeam = NUM_TEAMS;
 		return;
 	}
 
-	if ( ent->client->pers.team == TEAM_NONE )
+	if ( pers->team == TEAM_NONE )
 	{
 		if ( ent->client->sess.spectatorState == SPECTATOR_FREE ||
 		     ent->client->sess.spectatorClient < 0 )
@@ -402,7 +571,14 @@ void TeamplayInfoMessage( gentity_t *ent )
 	}
 	else
 	{
-		team = ent->client->pers.team;
+		team = pers->team;
+	}
+
+	// what was sent was about another team
+	if ( team != pers->teamInfoTeam )
+	{
+		memset( pers->teamInfoSent, 0, sizeof( pers->teamInfoSent ) );
+		pers->teamInfoTeam = team;
 	}
 
 	string[ 0 ] = '\0';
@@ -416,71 +592,66 @@ void TeamplayInfoMessage( gentity_t *ent )
 		if ( ent == player || !cl || team != cl->pers.team ||
 		     !player->inuse )
 		{
+			pers->teamInfoSent[ i ] = false;
 			continue;
 		}
 
-		// only update if changed since last time
-		if ( cl->pers.infoChangeTime <= ent->client->pers.teamInfo )
+		info = G_TeamInfo( player );
+		last = &pers->teamInfoLast[ i ];
+
+		if ( !pers->teamInfoSent[ i ] || last->enterTime != info->enterTime )
 		{
-			continue;
+			fields = TEAMINFO_LOCATION | TEAMINFO_HEALTH | TEAMINFO_WEAPON |
+			         TEAMINFO_CREDIT | TEAMINFO_UPGRADE;
+		}
+		else
+		{
+			fields = 0;
+
+			if ( last->location != info->location )             fields |= TEAMINFO_LOCATION;
+			if ( last->health != info->health )                 fields |= TEAMINFO_HEALTH;
+			if ( last->curWeaponClass != info->curWeaponClass ) fields |= TEAMINFO_WEAPON;
+			if ( last->credit != info->credit )                 fields |= TEAMINFO_CREDIT;
+			if ( last->upgrade != info->upgrade )               fields |= TEAMINFO_UPGRADE;
 		}
 
-		if ( cl->sess.spectatorState != SPECTATOR_NOT )
+		// aliens don't have upgrades
+		if ( team == TEAM_ALIENS )
 		{
-			curWeaponClass = WP_NONE;
-			upgrade = UP_NONE;
+			fields &= ~TEAMINFO_UPGRADE;
 		}
-		else if ( cl->pers.team == TEAM_HUMANS )
+
+		if ( !fields )
 		{
-			curWeaponClass = cl->ps.weapon;
+			continue;
+		}
 
-			if ( BG_InventoryContainsUpgrade( UP_BATTLESUIT, cl->ps.stats ) )
-			{
-				upgrade = UP_BATTLESUIT;
-			}
-			else if ( BG_InventoryContainsUpgrade( UP_JETPACK, cl->ps.stats ) )
-			{
-				upgrade = UP_JETPACK;
-			}
-			else if ( BG_InventoryContainsUpgrade( UP_RADAR, cl->ps.stats ) )
-			{
-				upgrade = UP_RADAR;
-			}
-			else if ( BG_InventoryContainsUpgrade( UP_LIGHTARMOUR, cl->ps.stats ) )
-			{
-				upgrade = UP_LIGHTARMOUR;
-			}
-			else
-			{
-				upgrade = UP_NONE;
-			}
-			health = static_cast<int>( std::ceil( player->entity->Get<HealthComponent>()->Health() ) );
+		Com_sprintf( entry, sizeof( entry ), " %i %i", i, fields );
+
+		if ( fields & TEAMINFO_LOCATION )
+		{
+			Q_strcat( entry, sizeof( entry ), va( " %i", info->location ) );
 		}
-		else if ( cl->pers.team == TEAM_ALIENS )
+
+		if ( fields & TEAMINFO_HEALTH )
 		{
-			curWeaponClass = cl->ps.stats[ STAT_CLASS ];
-			upgrade = UP_NONE;
-			health = static_cast<int>( std::ceil( player->entity->Get<HealthComponent>()->Health() ) );
+			Q_strcat( entry, sizeof( entry ), va( " %i", info->health ) );
 		}
 
-		if( team == TEAM_ALIENS ) // aliens don't have upgrades
+		if ( fields & TEAMINFO_WEAPON )
 		{
-			Com_sprintf( entry, sizeof( entry ), " %i %i %i %i %i", i,
-						 cl->pers.location,
-			             health,
-						 curWeaponClass,
-						 cl->pers.credit );
+			Q_strcat( entry, sizeof( entry ), va( " %i", info->curWeaponClass ) );
 		}
-		else
+
+		if ( fields & TEAMINFO_CREDIT )
 		{
-			Com_sprintf( entry, sizeof( entry ), " %i %i %i %i %i %i", i,
-			             cl->pers.location,
-			             health,
-			             curWeaponClass,
-			             cl->pers.credit,
-			             upgrade );
+			Q_strcat( entry, sizeof( entry ), va( " %i", info->credit ) );
 		}
 
+		if ( fields & TEAMINFO_UPGRADE )
+		{
+			Q_strcat( entry, sizeof( entry ), va( " %i", info->upgrade ) );
+		}
 
 		j = strlen( entry );
 
@@ -492,12 +663,15 @@ void TeamplayInfoMessage( gentity_t *ent )
 
 		strcpy( string + stringlength, entry );
 		stringlength += j;
+
+		*last = *info;
+		pers->teamInfoSent[ i ] = true;
 	}
 
 	if( string[ 0 ] )
 	{
 		trap_SendServerCommand( ent - g_entities, va( "tinfo%s", string ) );
-		ent->client->pers.teamInfo = level.time;
+		pers->teamInfo = level.time;
 	}
 }
 
@@ -524,19 +698,7 @@ void CheckTeamStatus()
 			{
 				loc = GetCloseLocationEntity( ent );
 
-				if ( loc )
-				{
-					if( ent->client->pers.location != loc->s.generic1 )
-					{
-						ent->client->pers.infoChangeTime = level.time;
-						ent->client->pers.location = loc->s.generic1;
-					}
-				}
-				else if ( ent->client->pers.location != 0 )
-				{
-					ent->client->pers.infoChangeTime = level.time;
-					ent->client->pers.location = 0;
-				}
+				ent->client->pers.location = loc ? loc->s.generic1 : 0;
 			}
 		}
 
@@ -42,8 +42,11 @@ typedef struct entityClass_s       entityClass_t;
 typedef struct gentity_s           gentity_t;
 typedef struct clientSession_s     clientSession_t;
 typedef struct namelog_s           namelog_t;
+typedef struct scoreboardRow_s     scoreboardRow_t;
+typedef struct teamInfo_s          teamInfo_t;
 typedef struct clientPersistant_s  clientPersistant_t;
 typedef struct unlagged_s          unlagged_t;
+typedef struct unlaggedFrame_s     unlaggedFrame_t;
 typedef struct gclient_s           gclient_t;
 typedef struct damageRegion_s      damageRegion_t;
 typedef struct spawnQueue_s        spawnQueue_t;
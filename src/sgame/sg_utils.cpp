@@ -26,6 +26,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "sg_local.h"
 #include "CBSE.h"
 
+#include <string>
+#include <unordered_map>
+
 typedef struct
 {
 	char  oldShader[ MAX_QPATH ];
@@ -92,69 +95,136 @@ model / sound configstring indexes
 */
 
 /*
-================
-G_FindConfigstringIndex
-
-================
-*/
-static int G_FindConfigstringIndex( const char *name, int start, int max, bool create )
+ * The strings of each configstring range are mirrored in a hash map, so that
+ * looking up an index does not fetch and compare every string of the range
+ * from the engine. A range is read from the engine once after the mirrors are
+ * reset, which happens whenever the game is initialised.
+ */
+class ConfigstringRange
 {
-	int  i;
-	char s[ MAX_STRING_CHARS ];
+public:
+	ConfigstringRange( int start, int max ) : start( start ), max( max ), count( 0 ), loaded( false ) {}
 
-	if ( !name || !name[ 0 ] )
+	int Find( const char *name, bool create )
 	{
-		return 0;
-	}
+		if ( !name || !name[ 0 ] )
+		{
+			return 0;
+		}
 
-	for ( i = 1; i < max; i++ )
-	{
-		trap_GetConfigstring( start + i, s, sizeof( s ) );
+		if ( !loaded )
+		{
+			Load();
+		}
 
-		if ( !s[ 0 ] )
+		auto it = indexes.find( name );
+
+		if ( it != indexes.end() )
 		{
-			break;
+			return it->second;
 		}
 
-		if ( !strcmp( s, name ) )
+		if ( !create )
 		{
-			return i;
+			return 0;
 		}
+
+		int i = count + 1;
+
+		if ( i == max )
+		{
+			Com_Error(errorParm_t::ERR_DROP,  "ConfigstringRange::Find: overflow at %i", start );
+		}
+
+		trap_SetConfigstring( start + i, name );
+		indexes.emplace( name, i );
+		count = i;
+
+		return i;
 	}
 
-	if ( !create )
+	void Reset()
 	{
-		return 0;
+		indexes.clear();
+		count = 0;
+		loaded = false;
 	}
 
-	if ( i == max )
+private:
+	void Load()
 	{
-		Com_Error(errorParm_t::ERR_DROP,  "G_FindConfigstringIndex: overflow" );
+		char s[ MAX_STRING_CHARS ];
+
+		for ( int i = 1; i < max; i++ )
+		{
+			trap_GetConfigstring( start + i, s, sizeof( s ) );
+
+			if ( !s[ 0 ] )
+			{
+				break;
+			}
+
+			// keep the first index of a name, as a scan of the range would
+			indexes.emplace( s, i );
+			count = i;
+		}
+
+		loaded = true;
 	}
 
-	trap_SetConfigstring( start + i, name );
+	const int start;
+	const int max;
+
+	std::unordered_map<std::string, int> indexes;
+	int  count; // last index in use
+	bool loaded;
+};
+
+static ConfigstringRange particleSystemIndexes( CS_PARTICLE_SYSTEMS, MAX_GAME_PARTICLE_SYSTEMS );
+static ConfigstringRange shaderIndexes( CS_SHADERS, MAX_GAME_SHADERS );
+static ConfigstringRange modelIndexes( CS_MODELS, MAX_MODELS );
+static ConfigstringRange soundIndexes( CS_SOUNDS, MAX_SOUNDS );
+// the first grading texture and reverb effect are the global ones
+static ConfigstringRange gradingTextureIndexes( CS_GRADING_TEXTURES + 1, MAX_GRADING_TEXTURES - 1 );
+static ConfigstringRange reverbEffectIndexes( CS_REVERB_EFFECTS + 1, MAX_REVERB_EFFECTS - 1 );
+static ConfigstringRange locationIndexes( CS_LOCATIONS, MAX_LOCATIONS );
 
-	return i;
+/*
+================
+G_ResetConfigstringIndexes
+
+Forgets the mirrored configstring ranges, they are read again on next use.
+================
+*/
+void G_ResetConfigstringIndexes()
+{
+	particleSystemIndexes.Reset();
+	shaderIndexes.Reset();
+	modelIndexes.Reset();
+	soundIndexes.Reset();
+	gradingTextureIndexes.Reset();
+	reverbEffectIndexes.Reset();
+	locationIndexes.Reset();
 }
 
 int G_ParticleSystemIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_PARTICLE_SYSTEMS, MAX_GAME_PARTICLE_SYSTEMS, true );
+	return particleSystemIndexes.Find( name, true );
 }
 
 int G_ShaderIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_SHADERS, MAX_GAME_SHADERS, true );
+	return shaderIndexes.Find( name, true );
 }
 
 int G_ModelIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_MODELS, MAX_MODELS, true );
+	return modelIndexes.Find( name, true );
 }
 
 int G_SoundIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_SOUNDS, MAX_SOUNDS, true );
+	return soundIndexes.Find( name, true );
 }
 
 /**
@@ -165,17 +235,17 @@ int G_SoundIndex( const char *name )
  */
 int G_GradingTextureIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_GRADING_TEXTURES+1, MAX_GRADING_TEXTURES-1, true );
+	return gradingTextureIndexes.Find( name, true );
 }
 
 int G_ReverbEffectIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_REVERB_EFFECTS+1, MAX_REVERB_EFFECTS-1, true );
+	return reverbEffectIndexes.Find( name, true );
 }
 
 int G_LocationIndex( const char *name )
 {
-	return G_FindConfigstringIndex( name, CS_LOCATIONS, MAX_LOCATIONS, true );
+	return locationIndexes.Find( name, true );
 }
 
 /*
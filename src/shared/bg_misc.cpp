@@ -26,6 +26,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "engine/qcommon/q_shared.h"
 #include "bg_public.h"
 
+#include <bitset>
+#include <unordered_map>
+
 #define N_(x) x
 
 int                                trap_FS_FOpenFile( const char *qpath, fileHandle_t *f, fsMode_t mode );
@@ -36,6 +39,70 @@ void                               trap_FS_Seek( fileHandle_t f, long offset, fs
 int                                trap_FS_GetFileList( const char *path, const char *extension, char *listbuf, int bufsize );
 void                               trap_QuoteString( const char *, char *, int );
 
+/*
+==============
+Name lookups
+
+Game data is looked up by name a lot: for every spawned entity and layout
+item, by bot purchase logic and by command parsing. The tables below map
+names case insensitively to indexes into the static data arrays and are
+built from them on first use. Duplicate names resolve to the first entry,
+like the linear scans they replace.
+==============
+*/
+struct nameHash_t
+{
+	size_t operator()( const char *name ) const
+	{
+		size_t hash = 2166136261u;
+
+		for ( ; *name; name++ )
+		{
+			hash = ( hash ^ ( unsigned char ) Str::ctolower( *name ) ) * 16777619u;
+		}
+
+		return hash;
+	}
+};
+
+struct nameEqual_t
+{
+	bool operator()( const char *a, const char *b ) const
+	{
+		return !Q_stricmp( a, b );
+	}
+};
+
+typedef std::unordered_map<const char *, int, nameHash_t, nameEqual_t> nameIndex_t;
+
+template<typename T, size_t N>
+static nameIndex_t BG_NameIndex( const T ( &table )[ N ], const char *T::*field )
+{
+	nameIndex_t index;
+
+	for ( size_t i = 0; i < N; i++ )
+	{
+		if ( table[ i ].*field )
+		{
+			index.emplace( table[ i ].*field, i );
+		}
+	}
+
+	return index;
+}
+
+static int BG_FindName( const nameIndex_t &index, const char *name )
+{
+	if ( !name )
+	{
+		return -1;
+	}
+
+	auto it = index.find( name );
+
+	return it == index.end() ? -1 : it->second;
+}
+
 typedef struct
 {
 	buildable_t number;
@@ -77,15 +144,10 @@ BG_BuildableByName
 */
 const buildableAttributes_t *BG_BuildableByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numBuildables; i++ )
-	{
-		if ( !Q_stricmp( bg_buildableList[ i ].name, name ) )
-		{
-			return &bg_buildableList[ i ];
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_buildableNameList, &buildableName_t::name );
+	int i = BG_FindName( index, name );
 
-	return &nullBuildable;
+	return i < 0 ? &nullBuildable : &bg_buildableList[ i ];
 }
 
 /*
@@ -95,15 +157,10 @@ BG_BuildableByEntityName
 */
 const buildableAttributes_t *BG_BuildableByEntityName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numBuildables; i++ )
-	{
-		if ( !Q_stricmp( bg_buildableList[ i ].entityName, name ) )
-		{
-			return &bg_buildableList[ i ];
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_buildableNameList, &buildableName_t::classname );
+	int i = BG_FindName( index, name );
 
-	return &nullBuildable;
+	return i < 0 ? &nullBuildable : &bg_buildableList[ i ];
 }
 
 /*
@@ -120,9 +177,12 @@ const buildableAttributes_t *BG_Buildable( int buildable )
 /*
 ===============
 BG_InitBuildableAttributes
+
+Sets the defaults, and parses the config files unless the attributes are
+restored from the config cache afterwards.
 ===============
 */
-void BG_InitBuildableAttributes()
+void BG_InitBuildableAttributes( bool parse )
 {
 	const buildableName_t *bh;
 	buildableAttributes_t *ba;
@@ -143,7 +203,10 @@ void BG_InitBuildableAttributes()
 		ba->bounce = 0.0;
 		ba->minNormal = 0.0;
 
-		BG_ParseBuildableAttributeFile( va( "configs/buildables/%s.attr.cfg", ba->name ), ba );
+		if ( parse )
+		{
+			BG_ParseBuildableAttributeFile( va( "configs/buildables/%s.attr.cfg", ba->name ), ba );
+		}
 	}
 }
 
@@ -296,18 +359,10 @@ BG_ClassByName
 */
 const classAttributes_t *BG_ClassByName( const char *name )
 {
-	if ( name )
-	{
-		for ( unsigned i = 0; i < bg_numClasses; i++ )
-		{
-			if ( !Q_stricmp( bg_classList[ i ].name, name ) )
-			{
-				return &bg_classList[ i ];
-			}
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_classData, &classData_t::name );
+	int i = BG_FindName( index, name );
 
-	return &nullClass;
+	return i < 0 ? &nullClass : &bg_classList[ i ];
 }
 
 /*
@@ -507,9 +562,12 @@ int BG_GetBarbRegenerationInterval(const playerState_t& ps)
 /*
 ===============
 BG_InitClassAttributes
+
+Sets the defaults, and parses the config files unless the attributes are
+restored from the config cache afterwards.
 ===============
 */
-void BG_InitClassAttributes()
+void BG_InitClassAttributes( bool parse )
 {
 	const classData_t *cd;
 	classAttributes_t *ca;
@@ -528,7 +586,10 @@ void BG_InitClassAttributes()
 		ca->bobCycle = 0.0f;
 		ca->abilities = 0;
 
-		BG_ParseClassAttributeFile( va( "configs/classes/%s.attr.cfg", ca->name ), ca );
+		if ( parse )
+		{
+			BG_ParseClassAttributeFile( va( "configs/classes/%s.attr.cfg", ca->name ), ca );
+		}
 	}
 }
 
@@ -594,15 +655,10 @@ static const weaponAttributes_t nullWeapon {};
 
 weapon_t BG_WeaponNumberByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numWeapons; i++ )
-	{
-		if ( !Q_stricmp( bg_weaponsData[ i ].name, name ) )
-		{
-			return bg_weaponsData[ i ].number;
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_weaponsData, &weaponData_t::name );
+	int i = BG_FindName( index, name );
 
-	return ( weapon_t )0;
+	return i < 0 ? ( weapon_t )0 : bg_weaponsData[ i ].number;
 }
 
 const weaponAttributes_t *BG_WeaponByName( const char *name )
@@ -633,9 +689,12 @@ const weaponAttributes_t *BG_Weapon( int weapon )
 /*
 ===============
 BG_InitWeaponAttributes
+
+Sets the defaults, and parses the config files unless the attributes are
+restored from the config cache afterwards.
 ===============
 */
-void BG_InitWeaponAttributes()
+void BG_InitWeaponAttributes( bool parse )
 {
 	const weaponData_t *wd;
 	weaponAttributes_t *wa;
@@ -653,7 +712,10 @@ void BG_InitWeaponAttributes()
 		// set default values for optional fields
 		wa->knockbackScale = 1.0f;
 
-		BG_ParseWeaponAttributeFile( va( "configs/weapon/%s.attr.cfg", wa->name ), wa );
+		if ( parse )
+		{
+			BG_ParseWeaponAttributeFile( va( "configs/weapon/%s.attr.cfg", wa->name ), wa );
+		}
 	}
 }
 
@@ -696,15 +758,10 @@ BG_UpgradeByName
 */
 const upgradeAttributes_t *BG_UpgradeByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numUpgrades; i++ )
-	{
-		if ( !Q_stricmp( bg_upgrades[ i ].name, name ) )
-		{
-			return &bg_upgrades[ i ];
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_upgradesData, &upgradeData_t::name );
+	int i = BG_FindName( index, name );
 
-	return &nullUpgrade;
+	return i < 0 ? &nullUpgrade : &bg_upgrades[ i ];
 }
 
 /*
@@ -721,9 +778,12 @@ const upgradeAttributes_t *BG_Upgrade( int upgrade )
 /*
 ===============
 BG_InitUpgradeAttributes
+
+Sets the defaults, and parses the config files unless the attributes are
+restored from the config cache afterwards.
 ===============
 */
-void BG_InitUpgradeAttributes()
+void BG_InitUpgradeAttributes( bool parse )
 {
 	const upgradeData_t *ud;
 	upgradeAttributes_t *ua;
@@ -739,7 +799,10 @@ void BG_InitUpgradeAttributes()
 		ua->number = ud->number;
 		ua->name = ud->name;
 
-		BG_ParseUpgradeAttributeFile( va( "configs/upgrades/%s.attr.cfg", ua->name ), ua );
+		if ( parse )
+		{
+			BG_ParseUpgradeAttributeFile( va( "configs/upgrades/%s.attr.cfg", ua->name ), ua );
+		}
 	}
 }
 
@@ -780,15 +843,10 @@ BG_MissileByName
 */
 const missileAttributes_t *BG_MissileByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numMissiles; i++ )
-	{
-		if ( !Q_stricmp( bg_missiles[ i ].name, name ) )
-		{
-			return &bg_missiles[ i ];
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_missilesData, &missileData_t::name );
+	int i = BG_FindName( index, name );
 
-	return &nullMissile;
+	return i < 0 ? &nullMissile : &bg_missiles[ i ];
 }
 
 /*
@@ -805,9 +863,12 @@ const missileAttributes_t *BG_Missile( int missile )
 /*
 ===============
 BG_InitMissileAttributes
+
+Sets the defaults, and parses the config files unless the attributes are
+restored from the config cache afterwards.
 ===============
 */
-void BG_InitMissileAttributes()
+void BG_InitMissileAttributes( bool parse )
 {
 	const missileData_t *md;
 	missileAttributes_t *ma;
@@ -822,9 +883,26 @@ void BG_InitMissileAttributes()
 		ma->name   = md->name;
 		ma->number = md->number;
 
+		if ( parse )
+		{
+			BG_ParseMissileAttributeFile( va( "configs/missiles/%s.missile.cfg", ma->name ), ma );
+		}
+	}
+}
+
+/*
+===============
+BG_InitMissileDisplays
+
+The display part of missiles holds media handles and is never cached.
+===============
+*/
+void BG_InitMissileDisplays()
+{
+	for ( unsigned i = 0; i < bg_numMissiles; i++ )
+	{
 		// for simplicity, read both from a single file
-		BG_ParseMissileAttributeFile( va( "configs/missiles/%s.missile.cfg", ma->name ), ma );
-		BG_ParseMissileDisplayFile(   va( "configs/missiles/%s.missile.cfg", ma->name ), ma );
+		BG_ParseMissileDisplayFile( va( "configs/missiles/%s.missile.cfg", bg_missiles[ i ].name ), &bg_missiles[ i ] );
 	}
 }
 
@@ -891,8 +969,6 @@ static const meansOfDeathData_t bg_meansOfDeathData[] =
 	{ MOD_REPLACE, "MOD_REPLACE" }
 };
 
-static const size_t bg_numMeansOfDeath = ARRAY_LEN( bg_meansOfDeathData );
-
 /*
 ==============
 BG_MeansOfDeathByName
@@ -900,15 +976,10 @@ BG_MeansOfDeathByName
 */
 meansOfDeath_t BG_MeansOfDeathByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numMeansOfDeath; i++ )
-	{
-		if ( !Q_stricmp( bg_meansOfDeathData[ i ].name, name ) )
-		{
-			return bg_meansOfDeathData[ i ].number;
-		}
-	}
+	static const nameIndex_t index = BG_NameIndex( bg_meansOfDeathData, &meansOfDeathData_t::name );
+	int i = BG_FindName( index, name );
 
-	return MOD_UNKNOWN;
+	return i < 0 ? MOD_UNKNOWN : bg_meansOfDeathData[ i ].number;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -945,11 +1016,10 @@ BG_BeaconByName
 */
 const beaconAttributes_t *BG_BeaconByName( const char *name )
 {
-	for ( unsigned i = 0; i < bg_numBeacons; i++ )
-		if ( !Q_stricmp( bg_beacons[ i ].name, name ) )
-			return bg_beacons + i;
+	static const nameIndex_t index = BG_NameIndex( bg_beaconsData, &beaconData_t::name );
+	int i = BG_FindName( index, name );
 
-	return nullptr;
+	return i < 0 ? nullptr : bg_beacons + i;
 }
 
 /*
@@ -995,6 +1065,487 @@ void BG_InitBeaconAttributes()
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*
+================
+Attribute config cache
+
+The attribute tables of buildables, classes, weapons, upgrades and missiles
+together with the config vars are stored in CONFIG_CACHE_FILE after they were
+parsed. The cache is keyed by a hash over the contents of all attribute
+config files and the build of the parsers, so both game modules can restore
+the tables from it instead of tokenising every file again, and fall back to
+parsing when anything changed. Each field is stored explicitly, the records
+themselves are never copied.
+
+Model, display and beacon configs register media or are module specific and
+are always parsed.
+================
+*/
+
+#define CONFIG_CACHE_FILE    "cache/bgconfigs.bin"
+#define CONFIG_CACHE_MAGIC   0x43425655 // "UVBC"
+#define CONFIG_CACHE_VERSION 2
+
+// the same sources give different tables when the parsers or the attribute
+// structs changed, so every build gets its own cache
+#define CONFIG_CACHE_BUILD   __DATE__ " " __TIME__
+
+typedef enum
+{
+	CACHE_INT,          // int or enum
+	CACHE_FLOAT,
+	CACHE_BOOL,
+	CACHE_STRING,       // allocated string or nullptr
+	CACHE_EMPTY_STRING  // as above, but the parser sets a static "" when empty
+} configCacheType_t;
+
+typedef struct
+{
+	size_t            offset;
+	configCacheType_t type;
+} configCacheField_t;
+
+#define CACHE_FIELD( type, record, member ) { offsetof( record, member ), type }
+
+typedef struct
+{
+	const char                      *path;   // config file name format, takes the name
+	void                            *base;
+	size_t                          stride;
+	size_t                          count;
+	size_t                          nameOffset; // static name, never cached
+	std::vector<configCacheField_t> fields;  // everything the parser sets
+} configCacheTable_t;
+
+typedef struct
+{
+	int      magic;
+	int      version;
+	uint64_t hash;
+	int      size;
+} configCacheHeader_t;
+
+static const std::vector<configCacheTable_t> &BG_ConfigCacheTables()
+{
+	static const std::vector<configCacheTable_t> tables = {
+		{ "configs/buildables/%s.attr.cfg", bg_buildableList, sizeof( buildableAttributes_t ), bg_numBuildables,
+		  offsetof( buildableAttributes_t, name ), {
+			CACHE_FIELD( CACHE_STRING, buildableAttributes_t, humanName ),
+			CACHE_FIELD( CACHE_STRING, buildableAttributes_t, info ),
+			CACHE_FIELD( CACHE_STRING, buildableAttributes_t, icon ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, traj ),
+			CACHE_FIELD( CACHE_FLOAT,  buildableAttributes_t, bounce ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, buildPoints ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, unlockThreshold ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, health ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, regenRate ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, splashDamage ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, splashRadius ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, weapon ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, meansOfDeath ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, team ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, buildWeapon ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, buildTime ),
+			CACHE_FIELD( CACHE_BOOL,   buildableAttributes_t, usable ),
+			CACHE_FIELD( CACHE_FLOAT,  buildableAttributes_t, minNormal ),
+			CACHE_FIELD( CACHE_BOOL,   buildableAttributes_t, invertNormal ),
+			CACHE_FIELD( CACHE_BOOL,   buildableAttributes_t, creepTest ),
+			CACHE_FIELD( CACHE_INT,    buildableAttributes_t, creepSize ),
+			CACHE_FIELD( CACHE_BOOL,   buildableAttributes_t, transparentTest ),
+			CACHE_FIELD( CACHE_BOOL,   buildableAttributes_t, uniqueTest ) } },
+		{ "configs/classes/%s.attr.cfg", bg_classList, sizeof( classAttributes_t ), bg_numClasses,
+		  offsetof( classAttributes_t, name ), {
+			CACHE_FIELD( CACHE_EMPTY_STRING, classAttributes_t, info ),
+			CACHE_FIELD( CACHE_STRING,       classAttributes_t, icon ),
+			CACHE_FIELD( CACHE_EMPTY_STRING, classAttributes_t, fovCvar ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, team ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, unlockThreshold ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, health ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, fallDamage ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, regenRate ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, abilities ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, startWeapon ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, buildDist ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, fov ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, bob ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, bobCycle ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, steptime ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, speed ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, sprintMod ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, acceleration ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, airAcceleration ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, friction ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, stopSpeed ),
+			CACHE_FIELD( CACHE_FLOAT,        classAttributes_t, jumpMagnitude ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, mass ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, staminaJumpCost ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, staminaSprintCost ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, staminaJogRestore ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, staminaWalkRestore ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, staminaStopRestore ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, cost ),
+			CACHE_FIELD( CACHE_INT,          classAttributes_t, value ) } },
+		{ "configs/weapon/%s.attr.cfg", bg_weapons, sizeof( weaponAttributes_t ), bg_numWeapons,
+		  offsetof( weaponAttributes_t, name ), {
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, price ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, unlockThreshold ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, slots ),
+			CACHE_FIELD( CACHE_STRING,       weaponAttributes_t, humanName ),
+			CACHE_FIELD( CACHE_EMPTY_STRING, weaponAttributes_t, info ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, maxAmmo ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, maxClips ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, infiniteAmmo ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, usesEnergy ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, repeatRate1 ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, repeatRate2 ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, repeatRate3 ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, reloadTime ),
+			CACHE_FIELD( CACHE_FLOAT,        weaponAttributes_t, knockbackScale ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, hasAltMode ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, hasThirdMode ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, canZoom ),
+			CACHE_FIELD( CACHE_FLOAT,        weaponAttributes_t, zoomFov ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, purchasable ),
+			CACHE_FIELD( CACHE_BOOL,         weaponAttributes_t, longRanged ),
+			CACHE_FIELD( CACHE_INT,          weaponAttributes_t, team ) } },
+		{ "configs/upgrades/%s.attr.cfg", bg_upgrades, sizeof( upgradeAttributes_t ), bg_numUpgrades,
+		  offsetof( upgradeAttributes_t, name ), {
+			CACHE_FIELD( CACHE_INT,          upgradeAttributes_t, price ),
+			CACHE_FIELD( CACHE_INT,          upgradeAttributes_t, unlockThreshold ),
+			CACHE_FIELD( CACHE_INT,          upgradeAttributes_t, slots ),
+			CACHE_FIELD( CACHE_STRING,       upgradeAttributes_t, humanName ),
+			CACHE_FIELD( CACHE_EMPTY_STRING, upgradeAttributes_t, info ),
+			CACHE_FIELD( CACHE_STRING,       upgradeAttributes_t, icon ),
+			CACHE_FIELD( CACHE_BOOL,         upgradeAttributes_t, purchasable ),
+			CACHE_FIELD( CACHE_BOOL,         upgradeAttributes_t, usable ),
+			CACHE_FIELD( CACHE_INT,          upgradeAttributes_t, team ) } },
+		{ "configs/missiles/%s.missile.cfg", bg_missiles, sizeof( missileAttributes_t ), bg_numMissiles,
+		  offsetof( missileAttributes_t, name ), {
+			CACHE_FIELD( CACHE_BOOL,  missileAttributes_t, pointAgainstWorld ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, damage ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, meansOfDeath ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, splashDamage ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, splashRadius ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, splashMeansOfDeath ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, clipmask ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, size ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, trajectoryType ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, speed ),
+			CACHE_FIELD( CACHE_FLOAT, missileAttributes_t, lag ),
+			CACHE_FIELD( CACHE_INT,   missileAttributes_t, flags ),
+			CACHE_FIELD( CACHE_BOOL,  missileAttributes_t, doKnockback ),
+			CACHE_FIELD( CACHE_BOOL,  missileAttributes_t, doLocationalDamage ) } },
+	};
+
+	return tables;
+}
+
+static void *ConfigCacheField( const configCacheTable_t &table, size_t index, size_t offset )
+{
+	return ( byte * ) table.base + index * table.stride + offset;
+}
+
+static const char *&ConfigCachePointer( const configCacheTable_t &table, size_t index, size_t offset )
+{
+	return *( const char ** ) ConfigCacheField( table, index, offset );
+}
+
+static uint64_t ConfigCacheHash( const void *data, size_t len, uint64_t hash )
+{
+	// FNV-1a
+	for ( size_t i = 0; i < len; i++ )
+	{
+		hash = ( hash ^ ( ( const byte * ) data )[ i ] ) * 1099511628211ull;
+	}
+
+	return hash;
+}
+
+/*
+===============
+BG_ConfigSourceHash
+
+Hashes the attribute config files, the builds of the parsers and the
+fields of the cached tables. Needs the names of all records set up.
+===============
+*/
+static uint64_t BG_ConfigSourceHash()
+{
+	uint64_t          hash = 14695981039346656037ull;
+	std::vector<char> buffer;
+	int               values[] = { CONFIG_CACHE_VERSION, ( int ) BG_ConfigVarsCacheSize() };
+
+	hash = ConfigCacheHash( values, sizeof( values ), hash );
+	hash = ConfigCacheHash( Q3_VERSION, strlen( Q3_VERSION ), hash );
+	hash = ConfigCacheHash( CONFIG_CACHE_BUILD, strlen( CONFIG_CACHE_BUILD ), hash );
+	hash = ConfigCacheHash( BG_ConfigParserBuild(), strlen( BG_ConfigParserBuild() ), hash );
+
+	for ( const configCacheTable_t &table : BG_ConfigCacheTables() )
+	{
+		hash = ConfigCacheHash( &table.count, sizeof( table.count ), hash );
+
+		for ( const configCacheField_t &field : table.fields )
+		{
+			hash = ConfigCacheHash( &field.offset, sizeof( field.offset ), hash );
+			hash = ConfigCacheHash( &field.type, sizeof( field.type ), hash );
+		}
+
+		for ( size_t i = 0; i < table.count; i++ )
+		{
+			const char   *filename = va( table.path, ConfigCachePointer( table, i, table.nameOffset ) );
+			fileHandle_t f;
+			int          len;
+
+			hash = ConfigCacheHash( filename, strlen( filename ) + 1, hash );
+			len = trap_FS_FOpenFile( filename, &f, fsMode_t::FS_READ );
+			hash = ConfigCacheHash( &len, sizeof( len ), hash );
+
+			if ( len <= 0 )
+			{
+				if ( len == 0 )
+				{
+					trap_FS_FCloseFile( f );
+				}
+
+				continue;
+			}
+
+			buffer.resize( len );
+			trap_FS_Read( buffer.data(), len, f );
+			trap_FS_FCloseFile( f );
+
+			hash = ConfigCacheHash( buffer.data(), len, hash );
+		}
+	}
+
+	return hash;
+}
+
+/*
+===============
+ConfigCacheWriteInt, ConfigCacheReadInt
+
+Four bytes, least significant first
+===============
+*/
+static void ConfigCacheWriteInt( std::vector<byte> &data, uint32_t value )
+{
+	for ( int i = 0; i < 4; i++ )
+	{
+		data.push_back( ( value >> ( 8 * i ) ) & 0xff );
+	}
+}
+
+static uint32_t ConfigCacheReadInt( const byte *in )
+{
+	return in[ 0 ] | ( in[ 1 ] << 8 ) | ( in[ 2 ] << 16 ) | ( ( uint32_t ) in[ 3 ] << 24 );
+}
+
+/*
+===============
+BG_WriteConfigCache
+===============
+*/
+static void BG_WriteConfigCache( uint64_t hash )
+{
+	std::vector<byte>   data;
+	configCacheHeader_t header;
+	fileHandle_t        f;
+
+	for ( const configCacheTable_t &table : BG_ConfigCacheTables() )
+	{
+		for ( size_t i = 0; i < table.count; i++ )
+		{
+			for ( const configCacheField_t &field : table.fields )
+			{
+				const void *value = ConfigCacheField( table, i, field.offset );
+				uint32_t   bits;
+
+				switch ( field.type )
+				{
+					case CACHE_INT:
+						ConfigCacheWriteInt( data, *( const int * ) value );
+						break;
+
+					case CACHE_FLOAT:
+						memcpy( &bits, value, sizeof( bits ) );
+						ConfigCacheWriteInt( data, bits );
+						break;
+
+					case CACHE_BOOL:
+						data.push_back( *( const bool * ) value );
+						break;
+
+					case CACHE_STRING:
+					case CACHE_EMPTY_STRING:
+					{
+						const char *string = *( const char * const * ) value;
+						int        len = string ? strlen( string ) + 1 : 0; // 0 means nullptr
+
+						data.push_back( len & 0xff );
+						data.push_back( len >> 8 );
+						data.insert( data.end(), string, string + len );
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	data.resize( data.size() + BG_ConfigVarsCacheSize() );
+	BG_WriteConfigVars( data.data() + data.size() - BG_ConfigVarsCacheSize() );
+
+	if ( trap_FS_FOpenFile( CONFIG_CACHE_FILE, &f, fsMode_t::FS_WRITE ) < 0 )
+	{
+		return;
+	}
+
+	header.magic   = CONFIG_CACHE_MAGIC;
+	header.version = CONFIG_CACHE_VERSION;
+	header.hash    = hash;
+	header.size    = data.size();
+
+	trap_FS_Write( &header, sizeof( header ), f );
+	trap_FS_Write( data.data(), data.size(), f );
+	trap_FS_FCloseFile( f );
+}
+
+/*
+===============
+BG_ReadConfigCache
+
+Restores the attribute tables if the cache matches the given source hash.
+A cache written by any other version or build is ignored and rewritten.
+===============
+*/
+static bool BG_ReadConfigCache( uint64_t hash )
+{
+	std::vector<byte>   data;
+	configCacheHeader_t header;
+	fileHandle_t        f;
+	int                 len;
+	size_t              pos = 0;
+
+	len = trap_FS_FOpenFile( CONFIG_CACHE_FILE, &f, fsMode_t::FS_READ );
+
+	if ( len < 0 )
+	{
+		return false;
+	}
+
+	if ( len < ( int ) sizeof( header ) ||
+	     trap_FS_Read( &header, sizeof( header ), f ) != ( int ) sizeof( header ) ||
+	     header.magic != CONFIG_CACHE_MAGIC || header.version != CONFIG_CACHE_VERSION ||
+	     header.hash != hash || header.size != len - ( int ) sizeof( header ) )
+	{
+		trap_FS_FCloseFile( f );
+		return false;
+	}
+
+	data.resize( header.size );
+	trap_FS_Read( data.data(), header.size, f );
+	trap_FS_FCloseFile( f );
+
+	// check the size before touching any table
+	for ( const configCacheTable_t &table : BG_ConfigCacheTables() )
+	{
+		for ( size_t i = 0; i < table.count; i++ )
+		{
+			for ( const configCacheField_t &field : table.fields )
+			{
+				switch ( field.type )
+				{
+					case CACHE_INT:
+					case CACHE_FLOAT:
+						pos += 4;
+						break;
+
+					case CACHE_BOOL:
+						pos += 1;
+						break;
+
+					case CACHE_STRING:
+					case CACHE_EMPTY_STRING:
+						if ( pos + 2 > data.size() )
+						{
+							return false;
+						}
+
+						pos += 2 + ( data[ pos ] | ( data[ pos + 1 ] << 8 ) );
+						break;
+				}
+			}
+		}
+	}
+
+	if ( pos + BG_ConfigVarsCacheSize() != data.size() )
+	{
+		return false;
+	}
+
+	pos = 0;
+
+	for ( const configCacheTable_t &table : BG_ConfigCacheTables() )
+	{
+		for ( size_t i = 0; i < table.count; i++ )
+		{
+			for ( const configCacheField_t &field : table.fields )
+			{
+				void     *value = ConfigCacheField( table, i, field.offset );
+				uint32_t bits;
+
+				switch ( field.type )
+				{
+					case CACHE_INT:
+						*( int * ) value = ConfigCacheReadInt( data.data() + pos );
+						pos += 4;
+						break;
+
+					case CACHE_FLOAT:
+						bits = ConfigCacheReadInt( data.data() + pos );
+						memcpy( value, &bits, sizeof( bits ) );
+						pos += 4;
+						break;
+
+					case CACHE_BOOL:
+						*( bool * ) value = data[ pos ] != 0;
+						pos += 1;
+						break;
+
+					case CACHE_STRING:
+					case CACHE_EMPTY_STRING:
+					{
+						int        len = data[ pos ] | ( data[ pos + 1 ] << 8 );
+						const char *string = ( const char * )( data.data() + pos + 2 );
+						const char *&pointer = *( const char ** ) value;
+
+						// match the parser, BG_UnloadAllConfigs frees all other strings
+						if ( !len )
+						{
+							pointer = nullptr;
+						}
+						else if ( len == 1 && field.type == CACHE_EMPTY_STRING )
+						{
+							pointer = "";
+						}
+						else
+						{
+							pointer = BG_strdup( string );
+						}
+
+						pos += 2 + len;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	BG_ReadConfigVars( data.data() + pos );
+
+	return true;
+}
+
 /*
 ================
 BG_InitAllConfigs
@@ -1006,13 +1557,28 @@ bool config_loaded = false;
 
 void BG_InitAllConfigs()
 {
-	BG_InitBuildableAttributes();
+	BG_InitBuildableAttributes( false );
+	BG_InitClassAttributes( false );
+	BG_InitWeaponAttributes( false );
+	BG_InitUpgradeAttributes( false );
+	BG_InitMissileAttributes( false );
+
+	uint64_t hash = BG_ConfigSourceHash();
+
+	if ( !BG_ReadConfigCache( hash ) )
+	{
+		BG_InitBuildableAttributes( true );
+		BG_InitClassAttributes( true );
+		BG_InitWeaponAttributes( true );
+		BG_InitUpgradeAttributes( true );
+		BG_InitMissileAttributes( true );
+
+		BG_WriteConfigCache( hash );
+	}
+
 	BG_InitBuildableModelConfigs();
-	BG_InitClassAttributes();
 	BG_InitClassModelConfigs();
-	BG_InitWeaponAttributes();
-	BG_InitUpgradeAttributes();
-	BG_InitMissileAttributes();
+	BG_InitMissileDisplays();
 	BG_InitBeaconAttributes();
 
 	BG_CheckConfigVars();
@@ -2533,43 +3099,107 @@ void BG_ParseCSVBuildableList( const char *string, buildable_t *buildables, int
 	buildables[ i ] = BA_NONE;
 }
 
-typedef struct gameElements_s
+// Disabled game elements are kept as one bit per item so that the checks,
+// which run in tight loops on both sides, are a single bit test. Items
+// already belong to a single team, so one set per kind covers every team.
+static struct
 {
-	buildable_t buildables[ BA_NUM_BUILDABLES ];
-	class_t     classes[ PCL_NUM_CLASSES ];
-	weapon_t    weapons[ WP_NUM_WEAPONS ];
-	upgrade_t   upgrades[ UP_NUM_UPGRADES ];
-} gameElements_t;
+	std::bitset<BA_NUM_BUILDABLES> buildables;
+	std::bitset<PCL_NUM_CLASSES>   classes;
+	std::bitset<WP_NUM_WEAPONS>    weapons;
+	std::bitset<UP_NUM_UPGRADES>   upgrades;
 
-static gameElements_t bg_disabledGameElements;
+	// the cvar values the sets were built from
+	char equipment[ MAX_CVAR_VALUE_STRING ];
+	char classList[ MAX_CVAR_VALUE_STRING ];
+	char buildableList[ MAX_CVAR_VALUE_STRING ];
+
+	int  generation;
+} bg_disabledGameElements;
 
 /*
 ============
 BG_InitAllowedGameElements
+
+Rebuilds the disabled sets from the g_disabled* cvars. Does nothing if none
+of them changed since the last call, so it is cheap to call whenever they
+might have.
 ============
 */
 void BG_InitAllowedGameElements()
 {
-	char cvar[ MAX_CVAR_VALUE_STRING ];
+	char equipment[ MAX_CVAR_VALUE_STRING ];
+	char classList[ MAX_CVAR_VALUE_STRING ];
+	char buildableList[ MAX_CVAR_VALUE_STRING ];
 
 	trap_Cvar_VariableStringBuffer( "g_disabledEquipment",
-	                                cvar, MAX_CVAR_VALUE_STRING );
+	                                equipment, MAX_CVAR_VALUE_STRING );
+	trap_Cvar_VariableStringBuffer( "g_disabledClasses",
+	                                classList, MAX_CVAR_VALUE_STRING );
+	trap_Cvar_VariableStringBuffer( "g_disabledBuildables",
+	                                buildableList, MAX_CVAR_VALUE_STRING );
 
-	BG_ParseCSVEquipmentList( cvar,
-	                          bg_disabledGameElements.weapons, WP_NUM_WEAPONS,
-	                          bg_disabledGameElements.upgrades, UP_NUM_UPGRADES );
+	if ( bg_disabledGameElements.generation &&
+	     !strcmp( equipment, bg_disabledGameElements.equipment ) &&
+	     !strcmp( classList, bg_disabledGameElements.classList ) &&
+	     !strcmp( buildableList, bg_disabledGameElements.buildableList ) )
+	{
+		return;
+	}
 
-	trap_Cvar_VariableStringBuffer( "g_disabledClasses",
-	                                cvar, MAX_CVAR_VALUE_STRING );
+	Q_strncpyz( bg_disabledGameElements.equipment, equipment, MAX_CVAR_VALUE_STRING );
+	Q_strncpyz( bg_disabledGameElements.classList, classList, MAX_CVAR_VALUE_STRING );
+	Q_strncpyz( bg_disabledGameElements.buildableList, buildableList, MAX_CVAR_VALUE_STRING );
 
-	BG_ParseCSVClassList( cvar,
-	                      bg_disabledGameElements.classes, PCL_NUM_CLASSES );
+	weapon_t    weapons[ WP_NUM_WEAPONS ];
+	upgrade_t   upgrades[ UP_NUM_UPGRADES ];
+	class_t     classes[ PCL_NUM_CLASSES ];
+	buildable_t buildables[ BA_NUM_BUILDABLES ];
 
-	trap_Cvar_VariableStringBuffer( "g_disabledBuildables",
-	                                cvar, MAX_CVAR_VALUE_STRING );
+	BG_ParseCSVEquipmentList( equipment, weapons, WP_NUM_WEAPONS,
+	                          upgrades, UP_NUM_UPGRADES );
+	BG_ParseCSVClassList( classList, classes, PCL_NUM_CLASSES );
+	BG_ParseCSVBuildableList( buildableList, buildables, BA_NUM_BUILDABLES );
 
-	BG_ParseCSVBuildableList( cvar,
-	                          bg_disabledGameElements.buildables, BA_NUM_BUILDABLES );
+	bg_disabledGameElements.weapons.reset();
+	bg_disabledGameElements.upgrades.reset();
+	bg_disabledGameElements.classes.reset();
+	bg_disabledGameElements.buildables.reset();
+
+	for ( int i = 0; i < WP_NUM_WEAPONS && weapons[ i ] != WP_NONE; i++ )
+	{
+		bg_disabledGameElements.weapons.set( weapons[ i ] );
+	}
+
+	for ( int i = 0; i < UP_NUM_UPGRADES && upgrades[ i ] != UP_NONE; i++ )
+	{
+		bg_disabledGameElements.upgrades.set( upgrades[ i ] );
+	}
+
+	for ( int i = 0; i < PCL_NUM_CLASSES && classes[ i ] != PCL_NONE; i++ )
+	{
+		bg_disabledGameElements.classes.set( classes[ i ] );
+	}
+
+	for ( int i = 0; i < BA_NUM_BUILDABLES && buildables[ i ] != BA_NONE; i++ )
+	{
+		bg_disabledGameElements.buildables.set( buildables[ i ] );
+	}
+
+	bg_disabledGameElements.generation++;
+}
+
+/*
+============
+BG_DisabledGameElementsGeneration
+
+Changes every time the disabled sets do, so that users of the sets can tell
+whether anything they derived from them is stale.
+============
+*/
+int BG_DisabledGameElementsGeneration()
+{
+	return bg_disabledGameElements.generation;
 }
 
 /*
@@ -2579,18 +3209,8 @@ BG_WeaponIsAllowed
 */
 bool BG_WeaponDisabled( int weapon )
 {
-	int i;
-
-	for ( i = 0; i < WP_NUM_WEAPONS &&
-	      bg_disabledGameElements.weapons[ i ] != WP_NONE; i++ )
-	{
-		if ( bg_disabledGameElements.weapons[ i ] == weapon )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return weapon > WP_NONE && weapon < WP_NUM_WEAPONS &&
+	       bg_disabledGameElements.weapons.test( weapon );
 }
 
 /*
@@ -2600,18 +3220,8 @@ BG_UpgradeIsAllowed
 */
 bool BG_UpgradeDisabled( int upgrade )
 {
-	int i;
-
-	for ( i = 0; i < UP_NUM_UPGRADES &&
-	      bg_disabledGameElements.upgrades[ i ] != UP_NONE; i++ )
-	{
-		if ( bg_disabledGameElements.upgrades[ i ] == upgrade )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return upgrade > UP_NONE && upgrade < UP_NUM_UPGRADES &&
+	       bg_disabledGameElements.upgrades.test( upgrade );
 }
 
 /*
@@ -2621,18 +3231,8 @@ BG_ClassDisabled
 */
 bool BG_ClassDisabled( int class_ )
 {
-	int i;
-
-	for ( i = 0; i < PCL_NUM_CLASSES &&
-	      bg_disabledGameElements.classes[ i ] != PCL_NONE; i++ )
-	{
-		if ( bg_disabledGameElements.classes[ i ] == class_ )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return class_ > PCL_NONE && class_ < PCL_NUM_CLASSES &&
+	       bg_disabledGameElements.classes.test( class_ );
 }
 
 /*
@@ -2642,18 +3242,8 @@ BG_BuildableIsAllowed
 */
 bool BG_BuildableDisabled( int buildable )
 {
-	int i;
-
-	for ( i = 0; i < BA_NUM_BUILDABLES &&
-	      bg_disabledGameElements.buildables[ i ] != BA_NONE; i++ )
-	{
-		if ( bg_disabledGameElements.buildables[ i ] == buildable )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return buildable > BA_NONE && buildable < BA_NUM_BUILDABLES &&
+	       bg_disabledGameElements.buildables.test( buildable );
 }
 
 /*
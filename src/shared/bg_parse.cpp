@@ -564,6 +564,49 @@ bool BG_CheckConfigVars()
 	return ok;
 }
 
+/*
+======================
+BG_ConfigParserBuild
+
+Identifies the build of the parsers for the attribute config cache
+======================
+*/
+const char *BG_ConfigParserBuild()
+{
+	return __DATE__ " " __TIME__;
+}
+
+/*
+======================
+BG_ConfigVarsCacheSize, BG_WriteConfigVars, BG_ReadConfigVars
+
+Store the config var values for the attribute config cache, four bytes for
+the value and one for the defined flag per var.
+======================
+*/
+size_t BG_ConfigVarsCacheSize()
+{
+	return bg_numConfigVars * 5;
+}
+
+void BG_WriteConfigVars( byte *out )
+{
+	for ( unsigned i = 0; i < bg_numConfigVars; i++, out += 5 )
+	{
+		memcpy( out, bg_configVars[ i ].var, 4 );
+		out[ 4 ] = bg_configVars[ i ].defined;
+	}
+}
+
+void BG_ReadConfigVars( const byte *in )
+{
+	for ( unsigned i = 0; i < bg_numConfigVars; i++, in += 5 )
+	{
+		memcpy( bg_configVars[ i ].var, in, 4 );
+		bg_configVars[ i ].defined = in[ 4 ];
+	}
+}
+
 /*
 ======================
 BG_ParseBuildableAttributeFile
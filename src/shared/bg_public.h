@@ -905,6 +905,13 @@ typedef struct animation_s
 // Time between location updates
 #define TEAM_LOCATION_UPDATE_TIME 500
 
+// fields present in a "tinfo" entry, each entry carries only the changed ones
+#define TEAMINFO_LOCATION         BIT(0)
+#define TEAMINFO_HEALTH           BIT(1)
+#define TEAMINFO_WEAPON           BIT(2) // weapon for humans, class for aliens
+#define TEAMINFO_CREDIT           BIT(3)
+#define TEAMINFO_UPGRADE          BIT(4)
+
 // player classes
 typedef enum
 {
@@ -1421,6 +1428,10 @@ void                      BG_UnloadAllConfigs();
 // Parsers
 bool                  BG_ReadWholeFile( const char *filename, char *buffer, int size);
 bool                  BG_CheckConfigVars();
+const char                *BG_ConfigParserBuild();
+size_t                    BG_ConfigVarsCacheSize();
+void                      BG_WriteConfigVars( byte *out );
+void                      BG_ReadConfigVars( const byte *in );
 bool                  BG_NonSegModel( const char *filename );
 void                      BG_ParseBuildableAttributeFile( const char *filename, buildableAttributes_t *ba );
 void                      BG_ParseBuildableModelFile( const char *filename, buildableModelConfig_t *bc );
@@ -1508,6 +1519,7 @@ void     BG_ParseCSVEquipmentList( const char *string, weapon_t *weapons, int we
 void     BG_ParseCSVClassList( const char *string, class_t *classes, int classesSize );
 void     BG_ParseCSVBuildableList( const char *string, buildable_t *buildables, int buildablesSize );
 void     BG_InitAllowedGameElements();
+int      BG_DisabledGameElementsGeneration();
 bool BG_WeaponDisabled( int weapon );
 bool BG_UpgradeDisabled( int upgrade );
 
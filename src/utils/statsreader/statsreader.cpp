@@ -0,0 +1,288 @@
+/*
+===========================================================================
+
+Copyright (C) 2026 Unvanquished Developers
+
+This file is part of Unvanquished.
+
+Unvanquished is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Unvanquished is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Unvanquished. If not, see <http://www.gnu.org/licenses/>.
+
+===========================================================================
+*/
+
+// statsreader.cpp -- prints a binary gameplay statistics stream as JSON lines
+//
+// usage: statsreader <file.stats>...
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "sgame/sg_stats.h"
+
+namespace {
+
+class Payload
+{
+public:
+	Payload( const unsigned char *data, int size ) : data( data ), size( size ), pos( 0 ) {}
+
+	bool Ok() const { return pos <= size; }
+
+	int Int8()  { return static_cast<int8_t>( Read( 1 ) ); }
+	int UInt8() { return static_cast<int>( Read( 1 ) ); }
+	int Int16() { return static_cast<int16_t>( Read( 2 ) ); }
+	int Int32() { return static_cast<int32_t>( Read( 4 ) ); }
+
+	float Float()
+	{
+		uint32_t bits = Read( 4 );
+		float value;
+		memcpy( &value, &bits, sizeof( value ) );
+		return value;
+	}
+
+	std::string String()
+	{
+		int len = UInt8();
+		std::string value;
+
+		if ( pos + len <= size )
+		{
+			value.assign( reinterpret_cast<const char*>( data + pos ), len );
+		}
+
+		pos += len;
+		return value;
+	}
+
+private:
+	uint32_t Read( int bytes )
+	{
+		uint32_t value = 0;
+
+		for ( int i = 0; i < bytes && pos + i < size; i++ )
+		{
+			value |= static_cast<uint32_t>( data[ pos + i ] ) << ( 8 * i );
+		}
+
+		pos += bytes;
+		return value;
+	}
+
+	const unsigned char *data;
+	int size;
+	int pos;
+};
+
+std::string Quote( const std::string &value )
+{
+	std::string out = "\"";
+
+	for ( char c : value )
+	{
+		if ( c == '"' || c == '\\' )
+		{
+			out += '\\';
+		}
+
+		if ( static_cast<unsigned char>( c ) >= 0x20 )
+		{
+			out += c;
+		}
+	}
+
+	return out + "\"";
+}
+
+void PrintRecord( int type, int time, Payload &p )
+{
+	printf( "{\"time\":%d,", time );
+
+	switch ( type )
+	{
+		case STATS_MATCH_START:
+		{
+			std::string version = p.String();
+			std::string map = p.String();
+			int initialBudget = p.Int32();
+			int budgetPerMiner = p.Int32();
+			int momentumHalfLife = p.Int32();
+
+			printf( "\"type\":\"match_start\",\"version\":%s,\"map\":%s,"
+			        "\"initialBudget\":%d,\"budgetPerMiner\":%d,\"momentumHalfLife\":%d",
+			        Quote( version ).c_str(), Quote( map ).c_str(),
+			        initialBudget, budgetPerMiner, momentumHalfLife );
+			break;
+		}
+		case STATS_MATCH_END:
+		{
+			int winner = p.UInt8();
+			int duration = p.Int32();
+
+			printf( "\"type\":\"match_end\",\"winner\":%d,\"duration\":%d", winner, duration );
+			break;
+		}
+		case STATS_KILL:
+		{
+			int killer = p.Int16();
+			int victim = p.Int16();
+			int killerTeam = p.UInt8();
+			int victimTeam = p.UInt8();
+			int victimClass = p.UInt8();
+			int mod = p.UInt8();
+			int assistant = p.Int16();
+			int assistantTeam = p.UInt8();
+
+			printf( "\"type\":\"kill\",\"killer\":%d,\"victim\":%d,\"killerTeam\":%d,\"victimTeam\":%d,"
+			        "\"victimClass\":%d,\"mod\":%d,\"assistant\":%d,\"assistantTeam\":%d",
+			        killer, victim, killerTeam, victimTeam, victimClass, mod, assistant, assistantTeam );
+			break;
+		}
+		case STATS_BUILD:
+		{
+			int builder = p.Int16();
+			int entity = p.Int16();
+			int team = p.UInt8();
+			int buildable = p.UInt8();
+			int x = p.Int32();
+			int y = p.Int32();
+			int z = p.Int32();
+
+			printf( "\"type\":\"build\",\"builder\":%d,\"entity\":%d,\"team\":%d,\"buildable\":%d,"
+			        "\"origin\":[%d,%d,%d]",
+			        builder, entity, team, buildable, x, y, z );
+			break;
+		}
+		case STATS_DESTROY:
+		{
+			int actor = p.Int16();
+			int entity = p.Int16();
+			int team = p.UInt8();
+			int buildable = p.UInt8();
+			int mod = p.UInt8();
+			int fate = p.UInt8();
+
+			printf( "\"type\":\"destroy\",\"actor\":%d,\"entity\":%d,\"team\":%d,\"buildable\":%d,"
+			        "\"mod\":%d,\"fate\":%d",
+			        actor, entity, team, buildable, mod, fate );
+			break;
+		}
+		case STATS_TEAM:
+		{
+			int team = p.UInt8();
+			int clients = p.UInt8();
+			float momentum = p.Float();
+			float totalBudget = p.Float();
+			int freeBudget = p.Int32();
+			int buildableValue = p.Int32();
+			int averageCredits = p.Int32();
+			int averageValue = p.Int32();
+
+			printf( "\"type\":\"team\",\"team\":%d,\"clients\":%d,\"momentum\":%.2f,\"totalBudget\":%.2f,"
+			        "\"freeBudget\":%d,\"buildableValue\":%d,\"averageCredits\":%d,\"averageValue\":%d",
+			        team, clients, momentum, totalBudget,
+			        freeBudget, buildableValue, averageCredits, averageValue );
+			break;
+		}
+		case STATS_DROPPED:
+			printf( "\"type\":\"dropped\",\"records\":%d", p.Int32() );
+			break;
+
+		default:
+			printf( "\"type\":%d", type );
+			break;
+	}
+
+	if ( !p.Ok() )
+	{
+		printf( ",\"truncated\":true" );
+	}
+
+	printf( "}\n" );
+}
+
+bool ReadStream( const char *filename )
+{
+	FILE *f = fopen( filename, "rb" );
+
+	if ( !f )
+	{
+		fprintf( stderr, "%s: could not open file\n", filename );
+		return false;
+	}
+
+	unsigned char header[ STATS_HEADER_SIZE ];
+
+	if ( fread( header, 1, sizeof( header ), f ) != sizeof( header ) ||
+	     memcmp( header, STATS_STREAM_MAGIC, STATS_STREAM_MAGIC_LEN ) )
+	{
+		fprintf( stderr, "%s: not a gameplay statistics stream\n", filename );
+		fclose( f );
+		return false;
+	}
+
+	int version = header[ STATS_STREAM_MAGIC_LEN ] | ( header[ STATS_STREAM_MAGIC_LEN + 1 ] << 8 );
+
+	if ( version != STATS_STREAM_VERSION )
+	{
+		fprintf( stderr, "%s: unsupported stream version %d\n", filename, version );
+		fclose( f );
+		return false;
+	}
+
+	unsigned char record[ STATS_RECORD_HEADER_SIZE + STATS_RECORD_MAX_PAYLOAD ];
+
+	while ( fread( record, 1, STATS_RECORD_HEADER_SIZE, f ) == STATS_RECORD_HEADER_SIZE )
+	{
+		int type = record[ 0 ];
+		int length = record[ 1 ];
+		int time = static_cast<int32_t>( record[ 2 ] | ( record[ 3 ] << 8 ) | ( record[ 4 ] << 16 ) |
+		                                 ( static_cast<uint32_t>( record[ 5 ] ) << 24 ) );
+
+		unsigned char *payload = record + STATS_RECORD_HEADER_SIZE;
+
+		if ( fread( payload, 1, length, f ) != static_cast<size_t>( length ) )
+		{
+			fprintf( stderr, "%s: stream ends inside a record\n", filename );
+			break;
+		}
+
+		Payload p( payload, length );
+		PrintRecord( type, time, p );
+	}
+
+	fclose( f );
+	return true;
+}
+
+} // namespace
+
+int main( int argc, char **argv )
+{
+	if ( argc < 2 )
+	{
+		fprintf( stderr, "usage: %s <file.stats>...\n", argv[ 0 ] );
+		return 2;
+	}
+
+	bool ok = true;
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		ok = ReadStream( argv[ i ] ) && ok;
+	}
+
+	return ok ? 0 : 1;
+}